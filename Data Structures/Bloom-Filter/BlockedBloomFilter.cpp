@@ -0,0 +1,108 @@
+/*
+Title: Blocked Bloom Filter
+Author: Edwin Khew
+Description: Blocked Bloom filter class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <cstdint>
+
+template<typename Hasher>
+BlockedBloomFilter<Hasher>::BlockedBloomFilter(size_t expected_count, size_t bits_per_key)
+{
+    block_count_ = (expected_count * bits_per_key + 511) / 512; //512 bits per block, rounded up
+
+    if(block_count_ == 0) //always keep at least one block, so that lookups never need a special case
+    {
+        block_count_ = 1;
+    }
+
+    blocks_ = new Block[block_count_];
+
+    clear();
+}
+
+template<typename Hasher>
+BlockedBloomFilter<Hasher>::~BlockedBloomFilter()
+{
+    delete[] blocks_;
+    blocks_ = nullptr;
+}
+
+template<typename Hasher>
+template<typename K>
+void BlockedBloomFilter<Hasher>::insert(const K &key)
+{
+    insertHash(hasher_(key));
+}
+
+template<typename Hasher>
+template<typename K>
+bool BlockedBloomFilter<Hasher>::mayContain(const K &key)
+{
+    return mayContainHash(hasher_(key));
+}
+
+template<typename Hasher>
+void BlockedBloomFilter<Hasher>::insertHash(uint64_t hash)
+{
+    Block &block = blocks_[blockIndex(hash)];
+
+    for(size_t i = 0; i < WORDS_PER_BLOCK_; i++)
+    {
+        block.words_[i] |= bitMask(hash, i);
+    }
+}
+
+template<typename Hasher>
+bool BlockedBloomFilter<Hasher>::mayContainHash(uint64_t hash)
+{
+    Block &block = blocks_[blockIndex(hash)];
+
+    //the key might be in the filter only if all of its bits are set; the loop has no early exit, so that compilers can turn it into a few vector instructions
+    uint64_t missing = 0;
+
+    for(size_t i = 0; i < WORDS_PER_BLOCK_; i++)
+    {
+        missing |= bitMask(hash, i) & ~block.words_[i];
+    }
+
+    return missing == 0;
+}
+
+template<typename Hasher>
+void BlockedBloomFilter<Hasher>::clear()
+{
+    for(size_t i = 0; i < block_count_; i++)
+    {
+        for(size_t j = 0; j < WORDS_PER_BLOCK_; j++)
+        {
+            blocks_[i].words_[j] = 0;
+        }
+    }
+}
+
+template<typename Hasher>
+size_t BlockedBloomFilter<Hasher>::sizeInBytes()
+{
+    return block_count_ * sizeof(Block);
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+template<typename Hasher>
+size_t BlockedBloomFilter<Hasher>::blockIndex(uint64_t hash)
+{
+    return static_cast<size_t>(((hash >> 32) * block_count_) >> 32); //maps the high 32 bits onto [0, block_count_) without a division
+}
+
+template<typename Hasher>
+uint64_t BlockedBloomFilter<Hasher>::bitMask(uint64_t hash, size_t word)
+{
+    //odd multipliers, one per word; multiplying the low 32 bits by each and keeping the top 6 bits of the product gives 8 independent bit positions
+    static const uint32_t SALTS[WORDS_PER_BLOCK_] = {0x47B6137BU, 0x44974D91U, 0x8824AD5BU, 0xA2B7289DU, 0x705495C7U, 0x2DF1424BU, 0x9EFC4947U, 0x5C6BFB31U};
+
+    return 1ULL << ((static_cast<uint32_t>(hash) * SALTS[word]) >> 26);
+}
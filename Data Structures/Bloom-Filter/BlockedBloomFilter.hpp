@@ -0,0 +1,106 @@
+/*
+Title: Blocked Bloom Filter
+Author: Edwin Khew
+Description: Blocked Bloom filter class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef BLOCKED_BLOOM_FILTER_H_
+#define BLOCKED_BLOOM_FILTER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+    an approximate set of keys; it can report that a key might be in the set when it is not (a false positive), but never that a key is not in the set when it is. Every key sets 8 bits inside a single 64-byte block, so each insert or lookup reads exactly one cache line
+*/
+template <class Hasher = WyHash>
+class BlockedBloomFilter
+{
+public:
+    /*
+        constructor; sizes the filter for the expected number of keys
+        @param expected_count, number of keys the filter is expected to hold; more can be inserted, at the cost of more false positives
+        @param bits_per_key, number of bits of the filter per expected key; 12 gives about 0.5% false positives, and every 4 more bits roughly divide that by 4
+    */
+    BlockedBloomFilter(size_t expected_count, size_t bits_per_key);
+
+    /*
+        destructor
+    */
+    ~BlockedBloomFilter();
+
+    BlockedBloomFilter(const BlockedBloomFilter &) = delete;
+    BlockedBloomFilter &operator=(const BlockedBloomFilter &) = delete;
+
+    /*
+        adds a key to the filter
+        @param key, key to add; can be any type the hasher accepts
+    */
+    template <class K>
+    void insert(const K &key);
+
+    /*
+        checks if a key might be in the filter
+        @param key, key to search for; can be any type the hasher accepts
+        @return false if the key is definitely not in the filter, and true if it might be
+    */
+    template <class K>
+    bool mayContain(const K &key);
+
+    /*
+        adds a key to the filter using its already computed hash; lets a hash table share the hash it computes anyway
+        @param hash, the full hash of the key; must come from the same hasher for every key of the filter
+    */
+    void insertHash(uint64_t hash);
+
+    /*
+        checks if a key might be in the filter using its already computed hash
+        @param hash, the full hash of the key
+        @return false if the key is definitely not in the filter, and true if it might be
+    */
+    bool mayContainHash(uint64_t hash);
+
+    /*
+        removes every key from the filter
+    */
+    void clear();
+
+    /*
+        returns the memory used by the filter's bits
+        @return the number of bytes used
+    */
+    size_t sizeInBytes();
+private:
+    static const size_t WORDS_PER_BLOCK_ = 8; //number of 64-bit words in a block; each key sets one bit in every word
+
+    /*
+        a group of bits that every key is confined to; aligned to a cache line, so that a block is read with a single cache miss
+    */
+    struct alignas(64) Block
+    {
+        uint64_t words_[WORDS_PER_BLOCK_]; //bits of the block
+    };
+
+    Block *blocks_; //array of blocks
+    size_t block_count_; //number of blocks; any positive count works, since blocks are chosen by multiplication rather than masking
+    Hasher hasher_; //hash function object; mixes a key into 64 well-distributed bits
+
+    /*
+        selects the block of a hash from its high 32 bits
+        @param hash, the full hash of the key
+        @return the index of the key's block
+    */
+    size_t blockIndex(uint64_t hash);
+
+    /*
+        computes the bit a hash sets in one word of its block from its low 32 bits
+        @param hash, the full hash of the key
+        @param word, index of the word within the block
+        @return a mask with exactly one bit set
+    */
+    uint64_t bitMask(uint64_t hash, size_t word);
+};
+
+#include "BlockedBloomFilter.cpp"
+#endif
@@ -0,0 +1,182 @@
+/*
+Title: Xor Filter
+Author: Edwin Khew
+Description: Xor filter class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <algorithm> //for std::sort and std::unique
+#include <cstdint>
+#include <utility> //for std::pair
+#include <vector>
+
+template<typename Hasher>
+XorFilter<Hasher>::XorFilter():block_length_(0), fingerprints_(nullptr), seed_(0)
+{
+    buildFromHashes(nullptr, 0); //an empty filter still needs its slots, so that lookups have something to read
+}
+
+template<typename Hasher>
+XorFilter<Hasher>::~XorFilter()
+{
+    delete[] fingerprints_;
+    fingerprints_ = nullptr;
+}
+
+template<typename Hasher>
+template<typename K>
+void XorFilter<Hasher>::build(const K *keys, size_t count)
+{
+    std::vector<uint64_t> hashes(count);
+
+    for(size_t i = 0; i < count; i++)
+    {
+        hashes[i] = hasher_(keys[i]);
+    }
+
+    //duplicate keys would share all three slots and could never be given one of their own, so only keep one of each
+    std::sort(hashes.begin(), hashes.end());
+    hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+
+    buildFromHashes(hashes.data(), hashes.size());
+}
+
+template<typename Hasher>
+template<typename K>
+bool XorFilter<Hasher>::mayContain(const K &key)
+{
+    return mayContainHash(hasher_(key));
+}
+
+template<typename Hasher>
+bool XorFilter<Hasher>::mayContainHash(uint64_t hash)
+{
+    uint64_t seeded = seededHash(hash);
+
+    return fingerprintOf(seeded) == (fingerprints_[slotOf(seeded, 0)] ^ fingerprints_[slotOf(seeded, 1)] ^ fingerprints_[slotOf(seeded, 2)]);
+}
+
+template<typename Hasher>
+size_t XorFilter<Hasher>::sizeInBytes()
+{
+    return 3 * block_length_;
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+template<typename Hasher>
+uint64_t XorFilter<Hasher>::seededHash(uint64_t hash)
+{
+    //64-bit MurmurHash3 finalizer; spreads the seed over every bit, so that a new seed gives unrelated slots
+    hash += seed_;
+    hash = (hash ^ (hash >> 33)) * 0xFF51AFD7ED558CCDULL;
+    hash = (hash ^ (hash >> 33)) * 0xC4CEB9FE1A85EC53ULL;
+
+    return hash ^ (hash >> 33);
+}
+
+template<typename Hasher>
+size_t XorFilter<Hasher>::slotOf(uint64_t hash, int block)
+{
+    uint64_t rotated = (block == 0) ? hash : (hash << (21 * block)) | (hash >> (64 - 21 * block)); //a different 32 bits of the hash for every block
+
+    return static_cast<size_t>(((rotated & 0xFFFFFFFFULL) * block_length_) >> 32) + block * block_length_; //maps the 32 bits onto the block without a division
+}
+
+template<typename Hasher>
+uint8_t XorFilter<Hasher>::fingerprintOf(uint64_t hash)
+{
+    return static_cast<uint8_t>(hash ^ (hash >> 32));
+}
+
+template<typename Hasher>
+void XorFilter<Hasher>::buildFromHashes(const uint64_t *hashes, size_t count)
+{
+    block_length_ = (32 + (123 * count) / 100) / 3 + 1; //1.23 slots per key (plus a few for tiny sets) is enough for building to almost always succeed on the first seed
+
+    delete[] fingerprints_;
+    fingerprints_ = new uint8_t[3 * block_length_];
+
+    std::vector<uint64_t> xor_masks(3 * block_length_); //XOR of the seeded hashes of every key that uses each slot
+    std::vector<uint32_t> counts(3 * block_length_); //number of keys that use each slot
+    std::vector<size_t> queue; //slots used by exactly one key
+    std::vector<std::pair<uint64_t, size_t>> order; //keys in the order they were peeled off, each with the slot it was given
+
+    while(true)
+    {
+        std::fill(xor_masks.begin(), xor_masks.end(), 0);
+        std::fill(counts.begin(), counts.end(), 0);
+        queue.clear();
+        order.clear();
+
+        for(size_t i = 0; i < count; i++)
+        {
+            uint64_t seeded = seededHash(hashes[i]);
+
+            for(int j = 0; j < 3; j++)
+            {
+                size_t slot = slotOf(seeded, j);
+                xor_masks[slot] ^= seeded;
+                counts[slot]++;
+            }
+        }
+
+        for(size_t i = 0; i < 3 * block_length_; i++)
+        {
+            if(counts[i] == 1)
+            {
+                queue.push_back(i);
+            }
+        }
+
+        //peel off keys that are the only user of one of their slots; that slot is theirs, and removing them may leave other slots with a single user
+        while(!queue.empty())
+        {
+            size_t slot = queue.back();
+            queue.pop_back();
+
+            if(counts[slot] != 1) //the slot's other user was peeled off since it was queued
+            {
+                continue;
+            }
+
+            uint64_t seeded = xor_masks[slot]; //with a single user, the XOR of the hashes is that user's hash
+            order.push_back(std::make_pair(seeded, slot));
+
+            for(int j = 0; j < 3; j++)
+            {
+                size_t other = slotOf(seeded, j);
+                xor_masks[other] ^= seeded;
+                counts[other]--;
+
+                if(counts[other] == 1)
+                {
+                    queue.push_back(other);
+                }
+            }
+        }
+
+        if(order.size() == count) //every key was peeled off
+        {
+            break;
+        }
+
+        seed_ = seed_ * 0x9E3779B97F4A7C15ULL + 1; //otherwise some keys' slots form a cycle; try again with new slots
+    }
+
+    for(size_t i = 0; i < 3 * block_length_; i++)
+    {
+        fingerprints_[i] = 0;
+    }
+
+    //assign fingerprints in the reverse order of peeling; each key's own slot is still free to be set, and its other two slots are never changed again afterwards
+    for(size_t i = order.size(); i > 0; i--)
+    {
+        uint64_t seeded = order[i - 1].first;
+        size_t slot = order[i - 1].second;
+
+        fingerprints_[slot] = fingerprintOf(seeded) ^ fingerprints_[slotOf(seeded, 0)] ^ fingerprints_[slotOf(seeded, 1)] ^ fingerprints_[slotOf(seeded, 2)]; //the key's own slot is still 0, so it drops out of the XOR
+    }
+}
@@ -0,0 +1,99 @@
+/*
+Title: Xor Filter
+Author: Edwin Khew
+Description: Xor filter class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef XOR_FILTER_H_
+#define XOR_FILTER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+    an approximate set of keys that is built once from a fixed set; like a Bloom filter it can give false positives but never false negatives. Every key is stored as an 8-bit fingerprint spread over 3 slots, which takes about 9.8 bits per key for 0.4% false positives, smaller than a Bloom filter with the same rate; the price is that keys cannot be added after building, and a lookup reads 3 slots instead of 1 block
+*/
+template <class Hasher = WyHash>
+class XorFilter
+{
+public:
+    /*
+        default constructor; the filter starts out holding no keys
+    */
+    XorFilter();
+
+    /*
+        destructor
+    */
+    ~XorFilter();
+
+    XorFilter(const XorFilter &) = delete;
+    XorFilter &operator=(const XorFilter &) = delete;
+
+    /*
+        replaces the contents of the filter with a set of keys
+        @param keys, pointer to the first of the keys; can be any type the hasher accepts, and duplicates are allowed
+        @param count, number of keys
+    */
+    template <class K>
+    void build(const K *keys, size_t count);
+
+    /*
+        checks if a key might be in the filter
+        @param key, key to search for; can be any type the hasher accepts
+        @return false if the key is definitely not in the filter, and true if it might be
+    */
+    template <class K>
+    bool mayContain(const K &key);
+
+    /*
+        checks if a key might be in the filter using its already computed hash
+        @param hash, the full hash of the key, from the filter's hasher
+        @return false if the key is definitely not in the filter, and true if it might be
+    */
+    bool mayContainHash(uint64_t hash);
+
+    /*
+        returns the memory used by the filter's fingerprints
+        @return the number of bytes used
+    */
+    size_t sizeInBytes();
+private:
+    size_t block_length_; //number of slots in each of the three blocks; a key has one slot in every block
+    uint8_t *fingerprints_; //array of '3 * block_length_' slots; the fingerprint of a key is the XOR of its three slots
+    uint64_t seed_; //seed mixed into every hash; changed whenever building fails, which gives every key new slots
+    Hasher hasher_; //hash function object; mixes a key into 64 well-distributed bits
+
+    /*
+        mixes the seed into a key's hash
+        @param hash, the full hash of the key
+        @return the seeded hash, which selects the key's slots and fingerprint
+    */
+    uint64_t seededHash(uint64_t hash);
+
+    /*
+        returns the slot of a seeded hash in one of the three blocks
+        @param hash, the seeded hash of the key
+        @param block, index of the block; 0, 1, or 2
+        @return the index of the slot
+    */
+    size_t slotOf(uint64_t hash, int block);
+
+    /*
+        returns the 8-bit fingerprint of a seeded hash
+        @param hash, the seeded hash of the key
+        @return the fingerprint
+    */
+    uint8_t fingerprintOf(uint64_t hash);
+
+    /*
+        fills the fingerprints from a set of unique hashes, trying new seeds until every key can be given a slot of its own
+        @param hashes, array of the unique hashes of the keys
+        @param count, number of hashes
+    */
+    void buildFromHashes(const uint64_t *hashes, size_t count);
+};
+
+#include "XorFilter.cpp"
+#endif
@@ -0,0 +1,85 @@
+/*
+Title: Bloom Filter (blocked Bloom filter and xor filter)
+Author: Edwin Khew
+Description: Bloom filter test file.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <string_view>
+#include "Hasher.hpp"
+#include "BlockedBloomFilter.hpp"
+#include "XorFilter.hpp"
+
+using namespace std;
+
+int main()
+{
+    BlockedBloomFilter<> myFilter(14, 12);
+    //BlockedBloomFilter<FibonacciHash> myFilter(14, 12); //hasher test; other hashers: WyHash (default), Crc32Hash
+
+    uint64_t myKeys[] = {279, 298, 264, 302, 301, 287, 289, 304, 280, 294, 295, 334, 292, 300};
+
+    for(int i = 0; i < 14; i++)
+    {
+        myFilter.insert(myKeys[i]);
+    }
+
+    cout << "May Contain (301): " << myFilter.mayContain(301) << endl;
+    cout << "May Contain (999): " << myFilter.mayContain(999) << endl;
+    cout << "Size In Bytes: " << myFilter.sizeInBytes() << endl;
+
+    myFilter.clear();
+
+    cout << "May Contain (After clear): " << myFilter.mayContain(301) << endl;
+
+    /*
+        xor filter test; built once from a fixed set of keys
+    */
+    XorFilter<> myXorFilter;
+    myXorFilter.build(myKeys, 14);
+
+    cout << endl << "May Contain (Xor, 301): " << myXorFilter.mayContain(301) << endl;
+    cout << "May Contain (Xor, 999): " << myXorFilter.mayContain(999) << endl;
+    cout << "Size In Bytes (Xor): " << myXorFilter.sizeInBytes() << endl;
+
+    /*
+        false positive test; fills both filters with a million keys, then counts how many of a million other keys they claim to contain
+    */
+    const size_t COUNT = 1000000;
+    uint64_t *manyKeys = new uint64_t[COUNT];
+    BlockedBloomFilter<> bigFilter(COUNT, 12);
+
+    for(size_t i = 0; i < COUNT; i++)
+    {
+        manyKeys[i] = i;
+        bigFilter.insert(manyKeys[i]);
+    }
+
+    XorFilter<> bigXorFilter;
+    bigXorFilter.build(manyKeys, COUNT);
+
+    size_t false_positives = 0, xor_false_positives = 0;
+
+    for(size_t i = COUNT; i < 2 * COUNT; i++)
+    {
+        false_positives += bigFilter.mayContain(i);
+        xor_false_positives += bigXorFilter.mayContain(i);
+    }
+
+    cout << endl << "False Positive Rate: " << 100.0 * false_positives / COUNT << "% (" << 8.0 * bigFilter.sizeInBytes() / COUNT << " bits per key)" << endl;
+    cout << "False Positive Rate (Xor): " << 100.0 * xor_false_positives / COUNT << "% (" << 8.0 * bigXorFilter.sizeInBytes() / COUNT << " bits per key)" << endl;
+
+    delete[] manyKeys;
+
+    /*
+        string key test; std::string and C-string keys are hashed through std::string_view
+    */
+    BlockedBloomFilter<> myStringFilter(3, 12);
+
+    myStringFilter.insert(string_view("Penny"));
+    myStringFilter.insert(string_view("Shelly"));
+    myStringFilter.insert(string_view("Colt"));
+
+    cout << endl << "May Contain (string_view): " << myStringFilter.mayContain(string_view("Shelly")) << endl;
+}
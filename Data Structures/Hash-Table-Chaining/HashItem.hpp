@@ -8,7 +8,7 @@ Date Created: 6/27/2021
 #ifndef HASH_ITEM_H_
 #define HASH_ITEM_H_
 
-template <class ItemType>
+template <class KeyType, class ItemType>
 class HashItem
 {
 public:
@@ -22,13 +22,13 @@ public:
         @param key, key of the item
         @param value, value stored in the item
     */
-    HashItem(int key, const ItemType value);
+    HashItem(const KeyType &key, const ItemType value);
 
     /*
         sets the key of the calling item
         @param key, the new key to be set
     */
-    void setKey(int key);
+    void setKey(const KeyType &key);
 
     /*
         sets the new value in the calling item
@@ -38,17 +38,23 @@ public:
 
     /*
         returns the key of the calling item
-        @return an integer representing the key of the item
+        @return a reference to the key of the item; returned by reference so that lookups on large keys (such as strings) do not copy them
     */
-    int getKey() const;
+    const KeyType &getKey() const;
 
     /*
         returns the value of the calling item
         @return the value of the item
     */
     ItemType getValue() const;
+
+    /*
+        returns a pointer to the value of the calling item
+        @return a pointer to the value stored in the item; lets callers read the value in place without copying it
+    */
+    ItemType *getValuePointer();
 private:
-    int key_; //the key of the item
+    KeyType key_; //the key of the item
     ItemType value_; //the value stored in the item
 };
 
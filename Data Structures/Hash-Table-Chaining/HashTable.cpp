@@ -6,95 +6,255 @@ Date Created: 6/27/2021
 */
 
 #include <list>
+#include <new> //for placement new
+#include <stdexcept> //for std::invalid_argument
 
-template<typename ItemType>
-HashTable<ItemType>::HashTable():item_count_(0), table_size_(11)
+#ifdef HASH_TABLE_STATS
+#include <algorithm> //for std::max
+#include <chrono> //for timing rehashes
+#endif
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::HashTable():item_count_(0), table_size_(MIN_TABLE_SIZE_), max_load_factor_(0.7), min_load_factor_(0.1), old_table_(nullptr), old_table_size_(0), migrate_index_(0), filter_(nullptr), old_filter_(nullptr), filter_bits_per_key_(0), filter_stale_count_(0)
 {
-    hash_table_ = new std::list<HashItem<ItemType>>[table_size_];
+    hash_table_ = allocateBuckets(table_size_);
 }
 
-template<typename ItemType>
-void HashTable<ItemType>::insert(int key, ItemType value)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::~HashTable()
 {
-    int address = hashFunction(key); //hash the key to get its address
+    deleteBuckets(hash_table_, table_size_);
+    deleteBuckets(old_table_, old_table_size_);
+    hash_table_ = nullptr;
+    old_table_ = nullptr;
 
-    HashItem<ItemType> new_item = HashItem<ItemType>(key, value); //create a new hash item (key-value pair)
+    delete filter_;
+    delete old_filter_;
+    filter_ = nullptr;
+    old_filter_ = nullptr;
+}
 
-    hash_table_[address].push_back(new_item); //insert the new item to the back of the list at the address
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::insert(const KeyType &key, ItemType value)
+{
+    migrateBuckets(MIGRATE_STEP_); //move a few buckets of an in-progress rehash along
 
-    item_count_++;
+    HashItem<KeyType, ItemType> new_item = HashItem<KeyType, ItemType>(key, value); //create a new hash item (key-value pair)
 
-    //if the load factor exceeds the specified limit after insertion of the new item, expand and rehash the table
-    if(loadFactor() > 0.7)
+    uint64_t hash = hasher_(key);
+
+    findBucket(hash).push_back(new_item); //insert the new item to the back of the list that the key belongs to
+
+    if(filter_ != nullptr)
     {
-        rehashTable();
+        filter_->insertHash(hash);
     }
 
+    item_count_++;
+
+    //if the load factor exceeds the specified limit after insertion of the new item, start expanding and rehashing the table
+    if(loadFactor() > max_load_factor_)
+    {
+        rehashTable(2 * table_size_);
+    }
 }
 
-template<typename ItemType>
-void HashTable<ItemType>::remove(int key)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+template<typename K>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::remove(const K &key)
 {
-    int address = hashFunction(key); //hash the key to get its address
+    migrateBuckets(MIGRATE_STEP_); //move a few buckets of an in-progress rehash along
 
-    typename std::list<HashItem<ItemType>>::iterator i; //iterator used to traverse through the list
-    for(i = hash_table_[address].begin(); i != hash_table_[address].end(); i++)
+    uint64_t hash = hasher_(key);
+
+    if(!filterMayContain(hash)) //the key was never inserted, so there is nothing to remove
     {
-        if(i->getKey() == key) //break from loop when a matching key is found
+        return;
+    }
+
+    Bucket &bucket = findBucket(hash); //list that the key belongs to
+
+    typename Bucket::iterator i; //iterator used to traverse through the list
+    for(i = bucket.begin(); i != bucket.end(); i++)
+    {
+        if(key_equal_(i->getKey(), key)) //break from loop when a matching key is found
         {
             break;
         }
     }
 
-    //only remove if a matching key was found; when the iterator reaches past the last item of the list at the address, this means no matching key was found
-    if(i != hash_table_[address].end())
+    //only remove if a matching key was found; when the iterator reaches past the last item of the list, this means no matching key was found
+    if(i != bucket.end())
     {
-        hash_table_[address].erase(i);
+        bucket.erase(i);
         item_count_--;
+
+        //if the load factor falls below the specified limit after removal of the item, shrink and rehash the table
+        if(loadFactor() < min_load_factor_ && table_size_ > MIN_TABLE_SIZE_)
+        {
+            rehashTable(table_size_ / 2);
+        }
+        //the removed key stays in the filter; once removes since the last rebuild reach half the table size, rehash at the same size, which rebuilds the filter from the remaining items as the buckets are moved
+        else if(filter_ != nullptr && ++filter_stale_count_ > table_size_ / 2)
+        {
+            rehashTable(table_size_);
+        }
     }
 }
 
-template<typename ItemType>
-void HashTable<ItemType>::clear()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::clear()
 {
-    for(int i = 0; i < table_size_; i++) //loop through each index of the array
+    //delete every list (and with it every item), including those of an in-progress rehash
+    deleteBuckets(hash_table_, table_size_);
+    deleteBuckets(old_table_, old_table_size_);
+    old_table_ = nullptr;
+    old_table_size_ = 0;
+    migrate_index_ = 0;
+
+    delete old_filter_;
+    old_filter_ = nullptr;
+
+    if(filter_ != nullptr)
     {
-        hash_table_[i].erase(hash_table_[i].begin(), hash_table_[i].end()); //for each list in the array, remove every item (erase in the range: first item -> past the last item)
+        filter_->clear();
+        filter_stale_count_ = 0;
     }
 
+    allocator_ = Allocator(); //drop the old allocator; with the slab allocator, its pool now has no users and returns all of its slabs at once
+    hash_table_ = allocateBuckets(table_size_);
+
     item_count_ = 0;
 }
 
-template<typename ItemType>
-bool HashTable<ItemType>::isEmpty()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::reserve(size_t count)
+{
+    size_t new_size = tableSizeFor(count);
+
+    if(new_size > table_size_)
+    {
+        rehashTable(new_size);
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::shrinkToFit()
+{
+    size_t new_size = tableSizeFor(item_count_);
+
+    if(new_size < table_size_)
+    {
+        rehashTable(new_size);
+
+        migrateBuckets(old_table_size_); //finish moving the buckets right away, so that the old table is freed now
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+double HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::maxLoadFactor()
+{
+    return max_load_factor_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::setMaxLoadFactor(double load_factor)
+{
+    if(!(load_factor > 0) || load_factor <= 2 * min_load_factor_)
+    {
+        throw(std::invalid_argument("Load factor out of range!"));
+    }
+
+    max_load_factor_ = load_factor;
+
+    reserve(item_count_); //grow the table if it is now over the limit
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+double HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::minLoadFactor()
+{
+    return min_load_factor_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::setMinLoadFactor(double load_factor)
+{
+    if(!(load_factor >= 0) || 2 * load_factor >= max_load_factor_)
+    {
+        throw(std::invalid_argument("Load factor out of range!"));
+    }
+
+    min_load_factor_ = load_factor;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::enableFilter(size_t bits_per_key)
+{
+    migrateBuckets(old_table_size_); //finish any rehash that is still in progress, so that a single filter covers every item
+
+    disableFilter();
+
+    filter_bits_per_key_ = bits_per_key;
+    filter_ = new BlockedBloomFilter<Hasher>(static_cast<size_t>(table_size_ * max_load_factor_), filter_bits_per_key_);
+    filter_stale_count_ = 0;
+
+    //add the key of every item already in the table
+    for(size_t i = 0; i < table_size_; i++)
+    {
+        for(auto &j : hash_table_[i])
+        {
+            filter_->insertHash(hasher_(j.getKey()));
+        }
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::disableFilter()
+{
+    delete filter_;
+    delete old_filter_;
+    filter_ = nullptr;
+    old_filter_ = nullptr;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+bool HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::isEmpty()
 {
     return item_count_ == 0;
 }
 
-template<typename ItemType>
-size_t HashTable<ItemType>::itemCount()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::itemCount()
 {
     return item_count_;
 }
 
-template<typename ItemType>
-ItemType HashTable<ItemType>::getValue(int key)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+template<typename K>
+ItemType HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::getValue(const K &key)
 {
-    int address = hashFunction(key); //hash the key to get its address
+    uint64_t hash = hasher_(key);
+
+    if(!filterMayContain(hash)) //if the filter has never seen the key, throw an exception without searching
+    {
+        throw(std::out_of_range("Position out of range!"));
+    }
+
+    Bucket &bucket = findBucket(hash); //list that the key belongs to
     ItemType value;
 
-    typename std::list<HashItem<ItemType>>::iterator i; //iterator used to traverse through the list
-    for(i = hash_table_[address].begin(); i != hash_table_[address].end(); i++)
+    typename Bucket::iterator i; //iterator used to traverse through the list
+    for(i = bucket.begin(); i != bucket.end(); i++)
     {
-        if(i->getKey() == key) //break from loop when a matching key is found
+        if(key_equal_(i->getKey(), key)) //break from loop when a matching key is found
         {
             value = i->getValue();
             break;
         }
     }
 
-    //only return value if a matching key was found; when the iterator reaches past the last item of the list at the address, this means no matching key was found
-    if(i != hash_table_[address].end())
+    //only return value if a matching key was found; when the iterator reaches past the last item of the list, this means no matching key was found
+    if(i != bucket.end())
     {
         return value;
     }
@@ -104,16 +264,24 @@ ItemType HashTable<ItemType>::getValue(int key)
     }
 }
 
-template<typename ItemType>
-bool HashTable<ItemType>::contains(int key)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+template<typename K>
+bool HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::contains(const K &key)
 {
-    int address = hashFunction(key); //hash the key to get its address
+    uint64_t hash = hasher_(key);
+
+    if(!filterMayContain(hash)) //the filter has never seen the key
+    {
+        return false;
+    }
+
+    Bucket &bucket = findBucket(hash); //list that the key belongs to
     bool found = false;
 
-    typename std::list<HashItem<ItemType>>::iterator i; //iterator used to traverse through the list
-    for(i = hash_table_[address].begin(); i != hash_table_[address].end(); i++)
+    typename Bucket::iterator i; //iterator used to traverse through the list
+    for(i = bucket.begin(); i != bucket.end(); i++)
     {
-        if(i->getKey() == key) //break from loop when a matching key is found
+        if(key_equal_(i->getKey(), key)) //break from loop when a matching key is found
         {
             found = true;
             break;
@@ -123,8 +291,54 @@ bool HashTable<ItemType>::contains(int key)
     return found;
 }
 
-template<typename ItemType>
-void HashTable<ItemType>::display()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::insertBatch(const std::pair<KeyType, ItemType> *items, size_t count)
+{
+    for(size_t start = 0; start < count; start += BATCH_SIZE_)
+    {
+        size_t end = (start + BATCH_SIZE_ < count) ? start + BATCH_SIZE_ : count; //one past the last item of the group
+
+        //prefetch the bucket of every item in the group first
+        for(size_t i = start; i < end; i++)
+        {
+            prefetchBucket(hasher_(items[i].first));
+        }
+
+        //then insert them; by now most of their buckets are already in the cache
+        for(size_t i = start; i < end; i++)
+        {
+            insert(items[i].first, items[i].second);
+        }
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+template<typename K>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::getValues(const K *keys, size_t count, ItemType **values)
+{
+    uint64_t hashes[BATCH_SIZE_]; //hashes of the current group of keys
+
+    for(size_t start = 0; start < count; start += BATCH_SIZE_)
+    {
+        size_t end = (start + BATCH_SIZE_ < count) ? start + BATCH_SIZE_ : count; //one past the last key of the group
+
+        //hash every key in the group and prefetch its bucket first
+        for(size_t i = start; i < end; i++)
+        {
+            hashes[i - start] = hasher_(keys[i]);
+            prefetchBucket(hashes[i - start]);
+        }
+
+        //then search for them; by now most of their buckets are already in the cache
+        for(size_t i = start; i < end; i++)
+        {
+            values[i] = findValue(keys[i], hashes[i - start]);
+        }
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::display()
 {
     for(int i = 0; i < table_size_; i++) //loop through each index of the array
     {
@@ -137,41 +351,276 @@ void HashTable<ItemType>::display()
 
         std::cout << std::endl;
     }
+
+    //while a rehash is in progress, also print the buckets of the old table that have not been moved yet
+    if(old_table_ != nullptr)
+    {
+        std::cout << "Old table (rehash in progress):" << std::endl;
+
+        for(size_t i = migrate_index_; i < old_table_size_; i++)
+        {
+            std::cout << i;
+
+            for(auto j : old_table_[i])
+            {
+                std::cout << " --> " << j.getValue();
+            }
+
+            std::cout << std::endl;
+        }
+    }
+}
+
+#ifdef HASH_TABLE_STATS
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+HashTableStats HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::stats()
+{
+    HashTableStats stats;
+
+    stats.item_count_ = item_count_;
+    stats.table_size_ = table_size_;
+    stats.load_factor_ = loadFactor();
+    stats.max_probe_length_ = 0;
+    stats.max_chain_length_ = 0;
+    stats.rehash_count_ = rehash_count_;
+    stats.rehash_seconds_ = rehash_seconds_;
+    stats.tombstone_ratio_ = 0;
+
+    //count the position of every item in its list; the old table still holds the buckets that have not been moved yet
+    Bucket *tables[2] = {hash_table_, old_table_};
+    size_t sizes[2] = {table_size_, old_table_size_};
+
+    for(int t = 0; t < 2; t++)
+    {
+        for(size_t i = 0; tables[t] != nullptr && i < sizes[t]; i++)
+        {
+            size_t length = tables[t][i].size();
+
+            if(length > stats.probe_histogram_.size())
+            {
+                stats.probe_histogram_.resize(length, 0);
+            }
+
+            //an item at position 'j' of its list is found after walking past 'j' other items
+            for(size_t j = 0; j < length; j++)
+            {
+                stats.probe_histogram_[j]++;
+            }
+
+            stats.max_chain_length_ = std::max(stats.max_chain_length_, length);
+        }
+    }
+
+    stats.max_probe_length_ = (stats.probe_histogram_.size() > 0) ? stats.probe_histogram_.size() - 1 : 0;
+
+    size_t bytes = (table_size_ + old_table_size_) * sizeof(Bucket) + item_count_ * (sizeof(HashItem<KeyType, ItemType>) + 2 * sizeof(void *)); //each list node also holds two links
+
+    if(filter_ != nullptr)
+    {
+        bytes += filter_->sizeInBytes() + (old_filter_ != nullptr ? old_filter_->sizeInBytes() : 0);
+    }
+
+    stats.bytes_per_entry_ = (item_count_ > 0) ? (1.0 * bytes) / item_count_ : 0;
+
+    return stats;
 }
+#endif
 
-template<typename ItemType>
-int HashTable<ItemType>::hashFunction(int key)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+template<typename K>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::hashFunction(const K &key)
 {
-    return key % table_size_;
+    return hasher_(key) & (table_size_ - 1); //table size is a power of two, so masking the low bits replaces the modulo
 }
 
-template<typename ItemType>
-double HashTable<ItemType>::loadFactor()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+double HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::loadFactor()
 {
     return (1.0 * item_count_) / table_size_;
 }
 
-template<typename ItemType>
-void HashTable<ItemType>::rehashTable()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::tableSizeFor(size_t count)
+{
+    size_t size = MIN_TABLE_SIZE_;
+
+    //double the table size until the items fit without exceeding the maximum load factor
+    while(count > size * max_load_factor_)
+    {
+        size = 2 * size;
+    }
+
+    return size;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::rehashTable(size_t new_size)
+{
+    migrateBuckets(old_table_size_); //finish any rehash that is still in progress; only one old table is kept at a time
+
+#ifdef HASH_TABLE_STATS
+    auto rehash_start = std::chrono::steady_clock::now();
+#endif
+
+    //keep the old table alive; its buckets are moved into the new table a few at a time by 'migrateBuckets'
+    old_table_ = hash_table_;
+    old_table_size_ = table_size_;
+    migrate_index_ = 0;
+
+    table_size_ = new_size;
+    hash_table_ = allocateBuckets(table_size_); //create a new array of lists with the new size
+
+    //likewise keep the old filter for the keys that have not been moved yet, and start a new filter sized for the new table; it only gets the keys that are moved or inserted from now on, so the keys removed so far are dropped
+    if(filter_ != nullptr)
+    {
+        old_filter_ = filter_;
+        filter_ = new BlockedBloomFilter<Hasher>(static_cast<size_t>(table_size_ * max_load_factor_), filter_bits_per_key_);
+        filter_stale_count_ = 0;
+    }
+
+#ifdef HASH_TABLE_STATS
+    rehash_count_++;
+    rehash_seconds_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - rehash_start).count();
+#endif
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+typename HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::Bucket &HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::findBucket(uint64_t hash)
+{
+    //while rehashing, a key whose old bucket has not been moved yet is still in the old table
+    if(old_table_ != nullptr && (hash & (old_table_size_ - 1)) >= migrate_index_)
+    {
+        return old_table_[hash & (old_table_size_ - 1)];
+    }
+
+    return hash_table_[hash & (table_size_ - 1)];
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::migrateBuckets(size_t count)
 {
-    std::list<HashItem<ItemType>> *temp = hash_table_; //create a temporary copy of the old table
+    if(old_table_ == nullptr) //no rehash in progress
+    {
+        return;
+    }
+
+#ifdef HASH_TABLE_STATS
+    auto rehash_start = std::chrono::steady_clock::now();
+#endif
+
+    for(size_t moved = 0; moved < count && migrate_index_ < old_table_size_; moved++)
+    {
+        Bucket &old_bucket = old_table_[migrate_index_];
 
-    size_t temp_size = table_size_; //create a temporary copy of the old table size
-    table_size_ = 2 * table_size_; //increase the table size
-    item_count_ = 0; //reset the item count
+        //relink every node of the old bucket into its new bucket; splicing moves the node itself, so nothing is copied or reallocated
+        while(!old_bucket.empty())
+        {
+            uint64_t hash = hasher_(old_bucket.front().getKey());
+            size_t address = hash & (table_size_ - 1);
+
+            if(filter_ != nullptr)
+            {
+                filter_->insertHash(hash);
+            }
+
+            hash_table_[address].splice(hash_table_[address].end(), old_bucket, old_bucket.begin());
+        }
+
+        migrate_index_++;
+    }
+
+    //once every bucket has been moved, delete the old table and free memory
+    if(migrate_index_ == old_table_size_)
+    {
+        deleteBuckets(old_table_, old_table_size_);
+        old_table_ = nullptr;
+        old_table_size_ = 0;
+        migrate_index_ = 0;
+
+        delete old_filter_;
+        old_filter_ = nullptr;
+    }
+
+#ifdef HASH_TABLE_STATS
+    rehash_seconds_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - rehash_start).count();
+#endif
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+bool HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::filterMayContain(uint64_t hash)
+{
+    if(filter_ == nullptr) //no filter; every key has to be searched for
+    {
+        return true;
+    }
+
+    return filter_->mayContainHash(hash) || (old_filter_ != nullptr && old_filter_->mayContainHash(hash));
+}
 
-    hash_table_ = new std::list<HashItem<ItemType>>[table_size_]; //create a new array of lists with the increased size
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+template<typename K>
+ItemType *HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::findValue(const K &key, uint64_t hash)
+{
+    if(!filterMayContain(hash)) //the filter has never seen the key
+    {
+        return nullptr;
+    }
 
-    //loop through the temporary copy and insert each item into the new table
-    for(int i = 0; i < temp_size; i++)
+    for(auto &i : findBucket(hash))
     {
-        for(auto j : temp[i])
+        //when an item with a matching key is found, return a pointer to its value
+        if(key_equal_(i.getKey(), key))
         {
-            insert(j.getKey(), j.getValue());
+            return i.getValuePointer();
         }
     }
 
-    //delete the old table and free memory
-    delete[] temp;
-    temp = nullptr;
+    //if no matching key was found, return 'nullptr'
+    return nullptr;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::prefetchBucket(uint64_t hash)
+{
+    prefetch(&findBucket(hash)); //the list object holds the pointer to its first node
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::prefetch(const void *address)
+{
+#if defined(__GNUC__)
+    __builtin_prefetch(address);
+#else
+    (void)address; //no portable prefetch; the batch functions still work, just without the overlap
+#endif
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+typename HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::Bucket *HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::allocateBuckets(size_t count)
+{
+    Bucket *buckets = static_cast<Bucket *>(::operator new(count * sizeof(Bucket))); //raw memory for the array
+
+    //construct every list with a copy of the table's allocator, so that all of them share one pool
+    for(size_t i = 0; i < count; i++)
+    {
+        new (&buckets[i]) Bucket(allocator_);
+    }
+
+    return buckets;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, typename Allocator>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual, Allocator>::deleteBuckets(Bucket *buckets, size_t count)
+{
+    if(buckets == nullptr)
+    {
+        return;
+    }
+
+    for(size_t i = 0; i < count; i++)
+    {
+        buckets[i].~Bucket();
+    }
+
+    ::operator delete(buckets);
 }
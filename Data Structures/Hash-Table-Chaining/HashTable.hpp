@@ -8,9 +8,12 @@ Date Created: 6/27/2021
 #ifndef HASH_TABLE_H_
 #define HASH_TABLE_H_
 
+#include <cstdint>
 #include <list>
+#include <functional> //for std::equal_to
+#include <utility> //for std::pair
 
-template <class ItemType>
+template <class KeyType, class ItemType, class Hasher = WyHash, class KeyEqual = std::equal_to<>, class Allocator = SlabAllocator<HashItem<KeyType, ItemType>>>
 class HashTable
 {
 public:
@@ -19,24 +22,79 @@ public:
     */
     HashTable();
 
+    /*
+        destructor
+    */
+    ~HashTable();
+
+    HashTable(const HashTable &) = delete;
+    HashTable &operator=(const HashTable &) = delete;
+
     /*
         inserts a new item into the hash table
         @param key, key of the item to insert
         @param value, value of the item to insert
     */
-    void insert(int key, const ItemType value);
+    void insert(const KeyType &key, const ItemType value);
 
     /*
         removes an item with the specified key from the hash table
-        @param key, key of the item to remove
+        @param key, key of the item to remove; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
     */
-    void remove(int key);
+    template <class K>
+    void remove(const K &key);
 
     /*
         removes every item from the hash table
     */
     void clear();
 
+    /*
+        presizes the table to hold the specified number of items without exceeding the maximum load factor, so that inserting them does not rehash; never shrinks the table
+        @param count, number of items the table should be able to hold
+    */
+    void reserve(size_t count);
+
+    /*
+        shrinks the table to the smallest size that holds its current items without exceeding the maximum load factor, freeing the memory left over from removed items
+    */
+    void shrinkToFit();
+
+    /*
+        returns the maximum load factor; the table grows once an insert takes the load factor above it
+        @return a decimal number representing the maximum load factor
+    */
+    double maxLoadFactor();
+
+    /*
+        sets the maximum load factor; if the table is already fuller than this, it is grown right away
+        @param load_factor, the new maximum load factor; must be greater than 0, and more than twice the minimum load factor
+    */
+    void setMaxLoadFactor(double load_factor);
+
+    /*
+        returns the minimum load factor; the table is halved once a remove takes the load factor below it
+        @return a decimal number representing the minimum load factor
+    */
+    double minLoadFactor();
+
+    /*
+        sets the minimum load factor; 0 stops the table from ever shrinking on its own
+        @param load_factor, the new minimum load factor; must be at least 0, and less than half the maximum load factor so that a halved table is not grown again by the next insert
+    */
+    void setMinLoadFactor(double load_factor);
+
+    /*
+        puts a blocked Bloom filter in front of the table; 'contains', 'getValue', 'getValues', and 'remove' check it first, and a key it has never seen returns right away without walking a list. Pays off when most lookups are for keys that are not in the table. The filter is resized along with the table, and rebuilt after enough removes leave it holding keys that are gone
+        @param bits_per_key, number of filter bits per item the table can hold before growing; 12 gives about 0.5% false positives
+    */
+    void enableFilter(size_t bits_per_key);
+
+    /*
+        removes the filter in front of the table and frees its memory
+    */
+    void disableFilter();
+
     /*
         checks if the table is currently empty
         @return true if the table is empty, false otherwise
@@ -51,33 +109,83 @@ public:
 
     /*
         returns the item with the specified key
-        @param key, key of the item to search for
+        @param key, key of the item to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
         @return the item with the matching key
     */
-    ItemType getValue(int key);
+    template <class K>
+    ItemType getValue(const K &key);
 
     /*
         checks the table to see if a an item with the specified key exists
-        @param key, key of the item to search for
+        @param key, key of the item to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
         @return true if the item exists in the table, and false otherwise
     */
-    bool contains(int key);
+    template <class K>
+    bool contains(const K &key);
+
+    /*
+        inserts a batch of items; the bucket of every item in a group of 'BATCH_SIZE_' is prefetched before any of them is inserted, so that their cache misses overlap instead of happening one after another
+        @param items, pointer to the first of the key-value pairs to insert
+        @param count, number of items to insert
+    */
+    void insertBatch(const std::pair<KeyType, ItemType> *items, size_t count);
+
+    /*
+        looks up a batch of keys; every key in a group of 'BATCH_SIZE_' is hashed and its bucket prefetched before any of them is searched for, so that their cache misses overlap instead of happening one after another
+        @param keys, pointer to the first of the keys to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+        @param count, number of keys to search for
+        @param values, array of at least 'count' pointers; each is set to the value of the matching item, or 'nullptr' if no item has that key. The pointers stay valid until the table is next modified
+    */
+    template <class K>
+    void getValues(const K *keys, size_t count, ItemType **values);
 
     /*
         prints every item currently in the table
     */
     void display();
+
+#ifdef HASH_TABLE_STATS
+    /*
+        collects statistics about the table, such as its load factor and how long its probe sequences are; scans the whole table, so it is meant for monitoring rather than for every operation. Only available when compiled with 'HASH_TABLE_STATS' defined
+        @return the statistics of the table
+    */
+    HashTableStats stats();
+#endif
 private:
+    typedef std::list<HashItem<KeyType, ItemType>, Allocator> Bucket; //linked list of the items in one bucket; its nodes come from 'Allocator'
+
+    static const size_t MIN_TABLE_SIZE_ = 16; //initial capacity of the table; it never shrinks below this
+    static const size_t BATCH_SIZE_ = 16; //number of keys hashed and prefetched at a time by the batch functions; about as many cache misses as a core can have in flight
     size_t item_count_; //current number of items in the table
-    size_t table_size_; //capacity of the hash table; the total number of available buckets
-    std::list<HashItem<ItemType>> *hash_table_; //array of linked lists
+    size_t table_size_; //capacity of the hash table; the total number of available buckets; always a power of two so that addresses can be masked instead of divided
+    double max_load_factor_; //the table grows once its load factor exceeds this
+    double min_load_factor_; //the table shrinks once its load factor falls below this
+    Bucket *hash_table_; //array of linked lists
+    Hasher hasher_; //hash function object; mixes a key into 64 well-distributed bits
+    KeyEqual key_equal_; //key comparison function object; checks if two keys are equal
+#ifdef HASH_TABLE_STATS
+    size_t rehash_count_ = 0; //number of times the table has been rehashed
+    double rehash_seconds_ = 0; //total time spent rehashing, in seconds
+#endif
+    Allocator allocator_; //node allocator; every list of the table is given a copy of it
+
+    static const size_t MIGRATE_STEP_ = 4; //number of old buckets moved into the new table by each insert or remove while rehashing
+    Bucket *old_table_; //table being rehashed; 'nullptr' when no rehash is in progress
+    size_t old_table_size_; //capacity of the old table
+    size_t migrate_index_; //index of the next old bucket to move; every old bucket below this index has already been moved
+
+    BlockedBloomFilter<Hasher> *filter_; //filter holding the hash of every key in the new table; 'nullptr' when the filter is disabled
+    BlockedBloomFilter<Hasher> *old_filter_; //filter of the old table; covers the keys that have not been moved yet, and is deleted along with the old table
+    size_t filter_bits_per_key_; //number of filter bits per item the table can hold
+    size_t filter_stale_count_; //number of removes since the filter was last rebuilt; removed keys stay in the filter and only cause false positives
 
     /*
         hash function; converts a key to an address
         @param key, key of the item to hash
         @return an integer representing the address of the item
     */
-    int hashFunction(int key);
+    template <class K>
+    size_t hashFunction(const K &key);
 
     /*
         returns the load factor of the hash table
@@ -86,9 +194,72 @@ private:
     double loadFactor();
 
     /*
-        rehashes the table when the load factor exceeds the limit
+        starts rehashing the table into a table of the specified size; the current table becomes the old table, and its buckets are moved into the new table a few at a time, so that no single insert or remove pays for the whole rehash
+        @param new_size, capacity of the new table; a power of two
+    */
+    void rehashTable(size_t new_size);
+
+    /*
+        finds the smallest table size that holds the specified number of items without exceeding the maximum load factor
+        @param count, number of items
+        @return the table size; a power of two
+    */
+    size_t tableSizeFor(size_t count);
+
+    /*
+        finds the list that an item with the specified hash belongs to; while rehashing, this is in the old table if the key's old bucket has not been moved yet, and in the new table otherwise
+        @param hash, the full hash of the item's key
+        @return a reference to the list that holds (or would hold) the item
+    */
+    Bucket &findBucket(uint64_t hash);
+
+    /*
+        moves buckets of the old table into the new table; does nothing when no rehash is in progress
+        @param count, maximum number of old buckets to move
+    */
+    void migrateBuckets(size_t count);
+
+    /*
+        checks the filter to see if an item with the specified hash might be in the table
+        @param hash, the full hash of the key
+        @return false if the item is definitely not in the table, and true if it might be or the filter is disabled
+    */
+    bool filterMayContain(uint64_t hash);
+
+    /*
+        searches the table for an item with the specified key, using its already computed hash
+        @param key, key of the item to search for
+        @param hash, the full hash of the key
+        @return a pointer to the value of the matching item, or 'nullptr' if the item does not exist
+    */
+    template <class K>
+    ItemType *findValue(const K &key, uint64_t hash);
+
+    /*
+        prefetches the memory that a search for the specified hash reads first
+        @param hash, the full hash of the key
+    */
+    void prefetchBucket(uint64_t hash);
+
+    /*
+        hints the processor to start loading the cache line holding the specified address
+        @param address, the address to prefetch
+    */
+    void prefetch(const void *address);
+
+    /*
+        creates an array of empty lists that all use the table's allocator
+        @param count, number of lists
+        @return a pointer to the array
+    */
+    Bucket *allocateBuckets(size_t count);
+
+    /*
+        deletes an array of lists created by 'allocateBuckets', along with every item in them
+        @param buckets, pointer to the array; may be 'nullptr'
+        @param count, number of lists in the array
     */
-    void rehashTable();
+    void deleteBuckets(Bucket *buckets, size_t count);
 };
 
 #include "HashTable.cpp"
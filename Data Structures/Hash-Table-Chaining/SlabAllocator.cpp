@@ -0,0 +1,116 @@
+/*
+Title: Slab Allocator
+Author: Edwin Khew
+Description: Slab pool and slab allocator class implementations.
+Date Created: 10/17/2026
+*/
+
+#include <cstddef>
+#include <memory>
+#include <new> //for ::operator new and ::operator delete
+
+inline SlabPool::SlabPool():request_size_(0), block_size_(0), free_list_(nullptr), current_(nullptr), remaining_(0) { }
+
+inline SlabPool::~SlabPool()
+{
+    for(auto i : slabs_)
+    {
+        ::operator delete(i);
+    }
+}
+
+inline void *SlabPool::allocate(size_t size, size_t alignment)
+{
+    if(request_size_ == 0) //the first request fixes the block size
+    {
+        request_size_ = size;
+        block_size_ = (size < sizeof(FreeBlock)) ? sizeof(FreeBlock) : size;
+        block_size_ = (block_size_ + alignment - 1) / alignment * alignment; //round up to a multiple of the alignment
+    }
+
+    if(size != request_size_ || block_size_ > SLAB_SIZE_) //not a block this pool serves
+    {
+        return ::operator new(size);
+    }
+
+    //reuse a freed block if there is one
+    if(free_list_ != nullptr)
+    {
+        FreeBlock *block = free_list_;
+        free_list_ = block->next_;
+
+        return block;
+    }
+
+    //otherwise carve the next block off the newest slab, starting a new slab when it runs out
+    if(remaining_ < block_size_)
+    {
+        current_ = static_cast<char *>(::operator new(SLAB_SIZE_)); //aligned for any fundamental type
+        remaining_ = SLAB_SIZE_;
+        slabs_.push_back(current_);
+    }
+
+    void *block = current_;
+    current_ += block_size_;
+    remaining_ -= block_size_;
+
+    return block;
+}
+
+inline void SlabPool::deallocate(void *pointer, size_t size)
+{
+    if(size != request_size_ || block_size_ > SLAB_SIZE_) //came from the system allocator
+    {
+        ::operator delete(pointer);
+        return;
+    }
+
+    //push the block onto the free list; the slab itself is kept until the pool is destroyed
+    FreeBlock *block = static_cast<FreeBlock *>(pointer);
+    block->next_ = free_list_;
+    free_list_ = block;
+}
+
+template<typename T>
+SlabAllocator<T>::SlabAllocator():pool_(std::make_shared<SlabPool>()) { }
+
+template<typename T>
+template<typename U>
+SlabAllocator<T>::SlabAllocator(const SlabAllocator<U> &other):pool_(other.pool_) { }
+
+template<typename T>
+T *SlabAllocator<T>::allocate(size_t n)
+{
+    if(n != 1) //arrays are not worth pooling
+    {
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+
+    return static_cast<T *>(pool_->allocate(sizeof(T), alignof(T)));
+}
+
+template<typename T>
+void SlabAllocator<T>::deallocate(T *pointer, size_t n)
+{
+    if(n != 1)
+    {
+        ::operator delete(pointer);
+        return;
+    }
+
+    pool_->deallocate(pointer, sizeof(T));
+}
+
+template<typename T>
+template<typename U>
+bool SlabAllocator<T>::operator==(const SlabAllocator<U> &other) const
+{
+    return pool_ == other.pool_;
+}
+
+template<typename T>
+template<typename U>
+bool SlabAllocator<T>::operator!=(const SlabAllocator<U> &other) const
+{
+    return pool_ != other.pool_;
+}
@@ -0,0 +1,120 @@
+/*
+Title: Slab Allocator
+Author: Edwin Khew
+Description: Slab pool and slab allocator class declarations.
+Date Created: 10/17/2026
+*/
+
+#ifndef SLAB_ALLOCATOR_H_
+#define SLAB_ALLOCATOR_H_
+
+#include <cstddef>
+#include <memory> //for std::shared_ptr
+#include <vector>
+
+/*
+    hands out fixed-size blocks carved from large contiguous slabs; freed blocks are kept on a free list for reuse, and the slabs themselves are only returned to the system all at once when the pool is destroyed
+*/
+class SlabPool
+{
+public:
+    /*
+        default constructor
+    */
+    SlabPool();
+
+    /*
+        destructor; frees every slab at once
+    */
+    ~SlabPool();
+
+    SlabPool(const SlabPool &) = delete;
+    SlabPool &operator=(const SlabPool &) = delete;
+
+    /*
+        allocates a block of memory; the first request fixes the pool's block size, and any request of a different size is passed on to the system allocator
+        @param size, size of the block in bytes
+        @param alignment, required alignment of the block
+        @return a pointer to the block
+    */
+    void *allocate(size_t size, size_t alignment);
+
+    /*
+        returns a block of memory to the pool
+        @param pointer, pointer to the block
+        @param size, size of the block in bytes; must match the size it was allocated with
+    */
+    void deallocate(void *pointer, size_t size);
+private:
+    static const size_t SLAB_SIZE_ = 64 * 1024; //size of each slab in bytes
+
+    /*
+        a free block; the link to the next free block is stored inside the block itself
+    */
+    struct FreeBlock
+    {
+        FreeBlock *next_; //next free block
+    };
+
+    size_t request_size_; //size of the blocks the pool serves; 0 until the first allocation
+    size_t block_size_; //'request_size_' rounded up so that every block in a slab stays aligned and can hold a 'FreeBlock'
+    FreeBlock *free_list_; //blocks that were freed and can be handed out again
+    char *current_; //next unused byte of the newest slab
+    size_t remaining_; //number of unused bytes left in the newest slab
+    std::vector<void *> slabs_; //every slab allocated so far
+};
+
+/*
+    standard allocator that takes its memory from a shared 'SlabPool'; copies (including copies rebound to another type, as std::list does for its nodes) share the same pool, so every list of a table packs its nodes into the same slabs
+*/
+template <class T>
+class SlabAllocator
+{
+public:
+    typedef T value_type;
+
+    /*
+        default constructor; creates a new pool
+    */
+    SlabAllocator();
+
+    /*
+        converting copy constructor; shares the pool of an allocator of another type
+        @param other, the allocator to share the pool of
+    */
+    template <class U>
+    SlabAllocator(const SlabAllocator<U> &other);
+
+    /*
+        allocates memory for an array of objects
+        @param n, number of objects
+        @return a pointer to uninitialized memory for the objects
+    */
+    T *allocate(size_t n);
+
+    /*
+        returns memory allocated by 'allocate' to the pool
+        @param pointer, pointer to the memory
+        @param n, number of objects the memory was allocated for
+    */
+    void deallocate(T *pointer, size_t n);
+
+    /*
+        checks if two allocators share the same pool; memory from one can only be freed by the other if they do
+        @param other, the allocator to compare with
+        @return true if both allocators share a pool, false otherwise
+    */
+    template <class U>
+    bool operator==(const SlabAllocator<U> &other) const;
+
+    template <class U>
+    bool operator!=(const SlabAllocator<U> &other) const;
+private:
+    template <class U>
+    friend class SlabAllocator;
+
+    std::shared_ptr<SlabPool> pool_; //the shared pool; freed with all its slabs once the last allocator using it is gone
+};
+
+#include "SlabAllocator.cpp"
+#endif
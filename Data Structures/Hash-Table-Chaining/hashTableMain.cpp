@@ -6,14 +6,21 @@ Date Created: 6/27/2021
 */
 
 #include <iostream>
+#include <string_view>
 #include "HashItem.hpp"
+#include "Hasher.hpp"
+#include "HashTableStats.hpp"
+#include "SlabAllocator.hpp"
+#include "BlockedBloomFilter.hpp"
 #include "HashTable.hpp"
 
 using namespace std;
 
 int main()
 {
-    HashTable<string> myTable;
+    HashTable<int, string> myTable;
+    //HashTable<int, string, FibonacciHash> myTable; //hasher test; other hashers: WyHash (default), Crc32Hash
+    //HashTable<int, string, WyHash, std::equal_to<>, std::allocator<HashItem<int, string>>> myTable; //allocator test; the default is SlabAllocator
 
     myTable.insert(279, "Penny");
     myTable.insert(298, "Shelly");
@@ -48,10 +55,91 @@ int main()
     cout << "Display: " << endl << endl;
     myTable.display();
 
+#ifdef HASH_TABLE_STATS
+    cout << endl << "Stats: " << endl << endl;
+    myTable.stats().display();
+#endif
+
     myTable.clear();
 
     cout << endl << "Is Empty (After clear): " << myTable.isEmpty() << endl;
     cout << "Item Count (After clear): " << myTable.itemCount() << endl;
     cout << "Display (After clear): " << endl << endl;
     myTable.display();
+
+    /*
+        batch test; inserts and looks up several items at once
+    */
+    pair<int, string> myBatch[] = {{279, "Penny"}, {298, "Shelly"}, {264, "Colt"}};
+    myTable.insertBatch(myBatch, 3);
+
+    int myKeys[] = {279, 264, 301};
+    string *myValues[3];
+    myTable.getValues(myKeys, 3, myValues);
+
+    for(int i = 0; i < 3; i++)
+    {
+        cout << endl << "Get Values (" << myKeys[i] << "): " << (myValues[i] != nullptr ? *myValues[i] : "Item not found!");
+    }
+
+    cout << endl;
+
+    /*
+        capacity test; presizes the table so that a bulk load does not rehash, then shrinks it back down once the items are gone
+    */
+    myTable.clear();
+    myTable.setMaxLoadFactor(0.5);
+    myTable.reserve(1000);
+
+    for(int i = 0; i < 1000; i++)
+    {
+        myTable.insert(i, "Item");
+    }
+
+    cout << endl << "Max Load Factor: " << myTable.maxLoadFactor() << endl;
+    cout << "Item Count (After reserve): " << myTable.itemCount() << endl;
+#ifdef HASH_TABLE_STATS
+    cout << "Table Size (After reserve): " << myTable.stats().table_size_ << endl;
+#endif
+
+    myTable.clear();
+    myTable.shrinkToFit();
+
+    cout << "Item Count (After shrink): " << myTable.itemCount() << endl;
+#ifdef HASH_TABLE_STATS
+    cout << "Table Size (After shrink): " << myTable.stats().table_size_ << endl;
+#endif
+
+    /*
+        filter test; a Bloom filter in front of the table answers lookups for missing keys without walking a list
+    */
+    myTable.clear();
+    myTable.enableFilter(12);
+
+    for(int i = 0; i < 1000; i++)
+    {
+        myTable.insert(i, "Item");
+    }
+
+    myTable.remove(500);
+
+    cout << endl << "Contains (Filter, 499): " << myTable.contains(499) << endl;
+    cout << "Contains (Filter, 500): " << myTable.contains(500) << endl;
+    cout << "Contains (Filter, 5000): " << myTable.contains(5000) << endl;
+
+    myTable.disableFilter();
+
+    /*
+        string key test; looks up std::string keys with std::string_view keys, which does not copy the key into a std::string
+    */
+    HashTable<string, int> myStringTable;
+
+    myStringTable.insert("Penny", 279);
+    myStringTable.insert("Shelly", 298);
+    myStringTable.insert("Colt", 264);
+
+    string_view name = "Shelly";
+
+    cout << endl << "Contains (string_view): " << myStringTable.contains(name) << endl;
+    cout << "Get Value (string_view): " << myStringTable.getValue(name) << endl;
 }
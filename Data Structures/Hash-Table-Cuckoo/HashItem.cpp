@@ -0,0 +1,42 @@
+/*
+Title: Hash Item (Key-Value pair)
+Author: Edwin Khew
+Description: Hash item class implementation.
+Date Created: 6/27/2021
+*/
+
+template<typename KeyType, typename ItemType>
+HashItem<KeyType, ItemType>::HashItem() { }
+
+template<typename KeyType, typename ItemType>
+HashItem<KeyType, ItemType>::HashItem(const KeyType &key, const ItemType value):key_(key), value_(value) { }
+
+template<typename KeyType, typename ItemType>
+void HashItem<KeyType, ItemType>::setKey(const KeyType &key)
+{
+    key_ = key;
+}
+
+template<typename KeyType, typename ItemType>
+void HashItem<KeyType, ItemType>::setValue(const ItemType value)
+{
+    value_ = value;
+}
+
+template<typename KeyType, typename ItemType>
+const KeyType &HashItem<KeyType, ItemType>::getKey() const
+{
+    return key_;
+}
+
+template<typename KeyType, typename ItemType>
+ItemType HashItem<KeyType, ItemType>::getValue() const
+{
+    return value_;
+}
+
+template<typename KeyType, typename ItemType>
+ItemType *HashItem<KeyType, ItemType>::getValuePointer()
+{
+    return &value_;
+}
@@ -0,0 +1,62 @@
+/*
+Title: Hash Item (Key-Value pair)
+Author: Edwin Khew
+Description: Hash item class declaration.
+Date Created: 6/27/2021
+*/
+
+#ifndef HASH_ITEM_H_
+#define HASH_ITEM_H_
+
+template <class KeyType, class ItemType>
+class HashItem
+{
+public:
+    /*
+        default constructor
+    */
+    HashItem();
+
+    /*
+        parameterized constructor
+        @param key, key of the item
+        @param value, value stored in the item
+    */
+    HashItem(const KeyType &key, const ItemType value);
+
+    /*
+        sets the key of the calling item
+        @param key, the new key to be set
+    */
+    void setKey(const KeyType &key);
+
+    /*
+        sets the new value in the calling item
+        @param value, new value to be set in the item
+    */
+    void setValue(const ItemType value);
+
+    /*
+        returns the key of the calling item
+        @return a reference to the key of the item; returned by reference so that lookups on large keys (such as strings) do not copy them
+    */
+    const KeyType &getKey() const;
+
+    /*
+        returns the value of the calling item
+        @return the value of the item
+    */
+    ItemType getValue() const;
+
+    /*
+        returns a pointer to the value of the calling item
+        @return a pointer to the value stored in the item; lets callers read the value in place without copying it
+    */
+    ItemType *getValuePointer();
+private:
+    KeyType key_; //the key of the item
+    ItemType value_; //the value stored in the item
+};
+
+#include "HashItem.cpp"
+#endif
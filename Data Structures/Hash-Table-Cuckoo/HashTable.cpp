@@ -0,0 +1,498 @@
+/*
+Title: Hash Table (bucketized cuckoo hashing)
+Author: Edwin Khew
+Description: Hash table class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <cstdint>
+#include <utility> //for std::move and std::swap
+#include <stdexcept> //for std::invalid_argument
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+HashTable<KeyType, ItemType, Hasher, KeyEqual>::HashTable():item_count_(0), bucket_count_(MIN_BUCKET_COUNT_), max_load_factor_(0.9), min_load_factor_(0.1), kick_slot_(0)
+{
+    buckets_ = new Bucket[bucket_count_];
+
+    //mark each slot as empty
+    for(size_t i = 0; i < bucket_count_; i++)
+    {
+        for(size_t j = 0; j < SLOTS_PER_BUCKET_; j++)
+        {
+            buckets_[i].tags_[j] = 0;
+        }
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+HashTable<KeyType, ItemType, Hasher, KeyEqual>::~HashTable()
+{
+    delete[] buckets_;
+    buckets_ = nullptr;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::insert(const KeyType &key, ItemType value)
+{
+    uint64_t hash = hasher_(key);
+    HashItem<KeyType, ItemType> *item = findItem(key, hash);
+
+    //if the key already exists, only replace its value
+    if(item != nullptr)
+    {
+        item->setValue(value);
+        return;
+    }
+
+    bool overflow = placeItem(HashItem<KeyType, ItemType>(key, value), hash);
+
+    item_count_++;
+
+    //if the load factor exceeds the specified limit after insertion of the new item, expand and rehash the table; with four slots per bucket, cuckoo hashing rarely fails below 95% load
+    //an overflowing stash also grows the table, unless the table is still half empty; then the keys' hashes collide so badly that growing would not help, and the stash is left to absorb them
+    if((overflow && loadFactor() > 0.5) || loadFactor() > max_load_factor_)
+    {
+        rehashTable(2 * bucket_count_);
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::remove(const K &key)
+{
+    uint64_t hash = hasher_(key);
+    uint8_t tag = tagOf(hash);
+    size_t bucket = hash & (bucket_count_ - 1);
+    bool removed = false; //set once the item has been found and removed
+
+    //check both buckets of the key
+    for(int i = 0; i < 2 && !removed; i++)
+    {
+        for(size_t j = 0; j < SLOTS_PER_BUCKET_ && !removed; j++)
+        {
+            if(buckets_[bucket].tags_[j] == tag && key_equal_(buckets_[bucket].items_[j].getKey(), key))
+            {
+                buckets_[bucket].tags_[j] = 0;
+                buckets_[bucket].items_[j].setValue(ItemType()); //release the value held by the slot
+                removed = true;
+            }
+        }
+
+        bucket = alternateBucket(bucket, tag);
+    }
+
+    //then the stash
+    for(size_t i = 0; i < stash_.size() && !removed; i++)
+    {
+        if(key_equal_(stash_[i].getKey(), key))
+        {
+            stash_.erase(stash_.begin() + i);
+            removed = true;
+        }
+    }
+
+    if(!removed) //item does not exist
+    {
+        return;
+    }
+
+    item_count_--;
+
+    //if the load factor falls below the specified limit after removal of the item, shrink and rehash the table
+    if(loadFactor() < min_load_factor_ && bucket_count_ > MIN_BUCKET_COUNT_)
+    {
+        rehashTable(bucket_count_ / 2);
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::clear()
+{
+    for(size_t i = 0; i < bucket_count_; i++) //loop through each slot of every bucket
+    {
+        for(size_t j = 0; j < SLOTS_PER_BUCKET_; j++)
+        {
+            if(buckets_[i].tags_[j] != 0) //release the value held by every full slot
+            {
+                buckets_[i].items_[j].setValue(ItemType());
+            }
+
+            buckets_[i].tags_[j] = 0;
+        }
+    }
+
+    stash_.clear();
+
+    item_count_ = 0;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::reserve(size_t count)
+{
+    size_t new_count = bucketCountFor(count);
+
+    if(new_count > bucket_count_)
+    {
+        rehashTable(new_count);
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::shrinkToFit()
+{
+    size_t new_count = bucketCountFor(item_count_);
+
+    if(new_count < bucket_count_)
+    {
+        rehashTable(new_count);
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+double HashTable<KeyType, ItemType, Hasher, KeyEqual>::maxLoadFactor()
+{
+    return max_load_factor_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::setMaxLoadFactor(double load_factor)
+{
+    if(!(load_factor > 0 && load_factor < 1) || load_factor <= 2 * min_load_factor_)
+    {
+        throw(std::invalid_argument("Load factor out of range!"));
+    }
+
+    max_load_factor_ = load_factor;
+
+    reserve(item_count_); //grow the table if it is now over the limit
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+double HashTable<KeyType, ItemType, Hasher, KeyEqual>::minLoadFactor()
+{
+    return min_load_factor_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::setMinLoadFactor(double load_factor)
+{
+    if(!(load_factor >= 0) || 2 * load_factor >= max_load_factor_)
+    {
+        throw(std::invalid_argument("Load factor out of range!"));
+    }
+
+    min_load_factor_ = load_factor;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+bool HashTable<KeyType, ItemType, Hasher, KeyEqual>::isEmpty()
+{
+    return item_count_ == 0;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::itemCount()
+{
+    return item_count_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+ItemType HashTable<KeyType, ItemType, Hasher, KeyEqual>::getValue(const K &key)
+{
+    HashItem<KeyType, ItemType> *item = findItem(key, hasher_(key));
+
+    if(item != nullptr) //when an item with a matching key is found, return its value
+    {
+        return item->getValue();
+    }
+
+    //if no matching key was found, throw an exception
+    throw(std::out_of_range("Position out of range!"));
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+bool HashTable<KeyType, ItemType, Hasher, KeyEqual>::contains(const K &key)
+{
+    return findItem(key, hasher_(key)) != nullptr;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::insertBatch(const std::pair<KeyType, ItemType> *items, size_t count)
+{
+    for(size_t start = 0; start < count; start += BATCH_SIZE_)
+    {
+        size_t end = (start + BATCH_SIZE_ < count) ? start + BATCH_SIZE_ : count; //one past the last item of the group
+
+        //prefetch the buckets of every item in the group first
+        for(size_t i = start; i < end; i++)
+        {
+            prefetchBucket(hasher_(items[i].first));
+        }
+
+        //then insert them; by now most of their buckets are already in the cache
+        for(size_t i = start; i < end; i++)
+        {
+            insert(items[i].first, items[i].second);
+        }
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::getValues(const K *keys, size_t count, ItemType **values)
+{
+    uint64_t hashes[BATCH_SIZE_]; //hashes of the current group of keys
+
+    for(size_t start = 0; start < count; start += BATCH_SIZE_)
+    {
+        size_t end = (start + BATCH_SIZE_ < count) ? start + BATCH_SIZE_ : count; //one past the last key of the group
+
+        //hash every key in the group and prefetch its buckets first
+        for(size_t i = start; i < end; i++)
+        {
+            hashes[i - start] = hasher_(keys[i]);
+            prefetchBucket(hashes[i - start]);
+        }
+
+        //then search for them; by now most of their buckets are already in the cache
+        for(size_t i = start; i < end; i++)
+        {
+            values[i] = findValue(keys[i], hashes[i - start]);
+        }
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::display()
+{
+    for(size_t i = 0; i < bucket_count_; i++)
+    {
+        for(size_t j = 0; j < SLOTS_PER_BUCKET_; j++)
+        {
+            if(buckets_[i].tags_[j] == 0) //empty slot
+            {
+                std::cout << i * SLOTS_PER_BUCKET_ + j << " " << std::endl;
+            }
+            else
+            {
+                std::cout << i * SLOTS_PER_BUCKET_ + j << " " << buckets_[i].items_[j].getValue() << std::endl;
+            }
+        }
+    }
+
+    std::cout << "Stash:";
+
+    for(auto &i : stash_)
+    {
+        std::cout << " " << i.getValue();
+    }
+
+    std::cout << std::endl;
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+uint8_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::tagOf(uint64_t hash)
+{
+    uint8_t tag = static_cast<uint8_t>(hash >> 56);
+
+    return (tag == 0) ? 1 : tag; //0 is reserved for empty slots
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::alternateBucket(size_t bucket, uint8_t tag)
+{
+    //XOR with an offset that only depends on the tag, so applying it twice cancels out; the offset is odd, so the two buckets always differ
+    return bucket ^ (((tag * 0x5BD1E995ULL) & (bucket_count_ - 1)) | 1);
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+HashItem<KeyType, ItemType> *HashTable<KeyType, ItemType, Hasher, KeyEqual>::findItem(const K &key, uint64_t hash)
+{
+    uint8_t tag = tagOf(hash);
+    size_t bucket = hash & (bucket_count_ - 1); //bucket count is a power of two, so masking the low bits replaces the modulo
+
+    //an item can only be in one of its two buckets, so a lookup never reads more than these two
+    for(int i = 0; i < 2; i++)
+    {
+        for(size_t j = 0; j < SLOTS_PER_BUCKET_; j++)
+        {
+            //only compare keys in slots whose tag matches; an 8-bit tag rules out all but ~1/255 of the non-matching items
+            if(buckets_[bucket].tags_[j] == tag && key_equal_(buckets_[bucket].items_[j].getKey(), key))
+            {
+                return &buckets_[bucket].items_[j];
+            }
+        }
+
+        bucket = alternateBucket(bucket, tag);
+    }
+
+    //the stash is almost always empty, so this loop usually costs nothing
+    for(auto &i : stash_)
+    {
+        if(key_equal_(i.getKey(), key))
+        {
+            return &i;
+        }
+    }
+
+    return nullptr;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+ItemType *HashTable<KeyType, ItemType, Hasher, KeyEqual>::findValue(const K &key, uint64_t hash)
+{
+    HashItem<KeyType, ItemType> *item = findItem(key, hash);
+
+    return (item != nullptr) ? item->getValuePointer() : nullptr;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+bool HashTable<KeyType, ItemType, Hasher, KeyEqual>::placeItem(HashItem<KeyType, ItemType> item, uint64_t hash)
+{
+    uint8_t tag = tagOf(hash);
+    size_t bucket = hash & (bucket_count_ - 1);
+
+    //use a free slot in either bucket if there is one
+    for(int i = 0; i < 2; i++)
+    {
+        size_t slot = freeSlot(bucket);
+
+        if(slot != SLOTS_PER_BUCKET_)
+        {
+            buckets_[bucket].tags_[slot] = tag;
+            buckets_[bucket].items_[slot] = std::move(item);
+            return false;
+        }
+
+        bucket = alternateBucket(bucket, tag);
+    }
+
+    //both buckets are full; take a slot from an item in the first bucket (the loop above stepped to the other bucket and back), and move that item to its other bucket, repeating until an item finds a free slot
+    for(size_t kicks = 0; kicks < MAX_KICKS_; kicks++)
+    {
+        size_t slot = kick_slot_++ % SLOTS_PER_BUCKET_;
+
+        std::swap(tag, buckets_[bucket].tags_[slot]);
+        std::swap(item, buckets_[bucket].items_[slot]);
+
+        bucket = alternateBucket(bucket, tag); //the displaced item's other bucket
+        slot = freeSlot(bucket);
+
+        if(slot != SLOTS_PER_BUCKET_)
+        {
+            buckets_[bucket].tags_[slot] = tag;
+            buckets_[bucket].items_[slot] = std::move(item);
+            return false;
+        }
+    }
+
+    //the item left over after the last kick goes into the stash
+    stash_.push_back(std::move(item));
+
+    return stash_.size() > STASH_SIZE_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::freeSlot(size_t bucket)
+{
+    for(size_t i = 0; i < SLOTS_PER_BUCKET_; i++)
+    {
+        if(buckets_[bucket].tags_[i] == 0)
+        {
+            return i;
+        }
+    }
+
+    return SLOTS_PER_BUCKET_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::prefetchBucket(uint64_t hash)
+{
+    size_t bucket = hash & (bucket_count_ - 1);
+
+    prefetch(buckets_ + bucket);
+    prefetch(buckets_ + alternateBucket(bucket, tagOf(hash)));
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::prefetch(const void *address)
+{
+#if defined(__GNUC__)
+    __builtin_prefetch(address);
+#else
+    (void)address; //no portable prefetch; the batch functions still work, just without the overlap
+#endif
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+double HashTable<KeyType, ItemType, Hasher, KeyEqual>::loadFactor()
+{
+    return (1.0 * item_count_) / (bucket_count_ * SLOTS_PER_BUCKET_);
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::bucketCountFor(size_t count)
+{
+    size_t size = MIN_BUCKET_COUNT_;
+
+    //double the bucket count until the items fit without exceeding the maximum load factor
+    while(count > size * SLOTS_PER_BUCKET_ * max_load_factor_)
+    {
+        size = 2 * size;
+    }
+
+    return size;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::rehashTable(size_t new_count)
+{
+    Bucket *temp = buckets_; //create a temporary copy of the old buckets
+    std::vector<HashItem<KeyType, ItemType>> temp_stash = std::move(stash_); //create a temporary copy of the old stash
+
+    size_t temp_count = bucket_count_; //create a temporary copy of the old bucket count
+    bucket_count_ = new_count;
+
+    buckets_ = new Bucket[bucket_count_]; //create a new array of buckets with the new size
+    stash_.clear();
+
+    for(size_t i = 0; i < bucket_count_; i++)
+    {
+        for(size_t j = 0; j < SLOTS_PER_BUCKET_; j++)
+        {
+            buckets_[i].tags_[j] = 0;
+        }
+    }
+
+    //loop through the old buckets and stash and move each item into the new table; keys are already unique, so no lookups are needed
+    for(size_t i = 0; i < temp_count; i++)
+    {
+        for(size_t j = 0; j < SLOTS_PER_BUCKET_; j++)
+        {
+            if(temp[i].tags_[j] != 0)
+            {
+                uint64_t hash = hasher_(temp[i].items_[j].getKey()); //hash before moving, since the move empties the key
+                placeItem(std::move(temp[i].items_[j]), hash);
+            }
+        }
+    }
+
+    for(auto &i : temp_stash)
+    {
+        uint64_t hash = hasher_(i.getKey());
+        placeItem(std::move(i), hash);
+    }
+
+    //delete the old buckets and free memory
+    delete[] temp;
+    temp = nullptr;
+}
@@ -0,0 +1,242 @@
+/*
+Title: Hash Table (bucketized cuckoo hashing)
+Author: Edwin Khew
+Description: Hash table class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef HASH_TABLE_H_
+#define HASH_TABLE_H_
+
+#include <cstdint>
+#include <functional> //for std::equal_to
+#include <utility> //for std::pair
+#include <vector>
+
+template <class KeyType, class ItemType, class Hasher = WyHash, class KeyEqual = std::equal_to<>>
+class HashTable
+{
+public:
+    /*
+        default constructor
+    */
+    HashTable();
+
+    /*
+        destructor
+    */
+    ~HashTable();
+
+    HashTable(const HashTable &) = delete;
+    HashTable &operator=(const HashTable &) = delete;
+
+    /*
+        inserts a new item into the hash table; if an item with the same key already exists, its value is replaced
+        @param key, key of the item to insert
+        @param value, value of the item to insert
+    */
+    void insert(const KeyType &key, const ItemType value);
+
+    /*
+        removes an item with the specified key from the hash table
+        @param key, key of the item to remove; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+    */
+    template <class K>
+    void remove(const K &key);
+
+    /*
+        removes every item from the hash table
+    */
+    void clear();
+
+    /*
+        presizes the table to hold the specified number of items without exceeding the maximum load factor, so that inserting them does not rehash; never shrinks the table
+        @param count, number of items the table should be able to hold
+    */
+    void reserve(size_t count);
+
+    /*
+        shrinks the table to the smallest size that holds its current items without exceeding the maximum load factor, freeing the memory left over from removed items
+    */
+    void shrinkToFit();
+
+    /*
+        returns the maximum load factor; the table grows once an insert takes the load factor above it
+        @return a decimal number representing the maximum load factor
+    */
+    double maxLoadFactor();
+
+    /*
+        sets the maximum load factor; if the table is already fuller than this, it is grown right away
+        @param load_factor, the new maximum load factor; must be greater than 0 and below 1, and more than twice the minimum load factor
+    */
+    void setMaxLoadFactor(double load_factor);
+
+    /*
+        returns the minimum load factor; the table is halved once a remove takes the load factor below it
+        @return a decimal number representing the minimum load factor
+    */
+    double minLoadFactor();
+
+    /*
+        sets the minimum load factor; 0 stops the table from ever shrinking on its own
+        @param load_factor, the new minimum load factor; must be at least 0, and less than half the maximum load factor so that a halved table is not grown again by the next insert
+    */
+    void setMinLoadFactor(double load_factor);
+
+    /*
+        checks if the table is currently empty
+        @return true if the table is empty, false otherwise
+    */
+    bool isEmpty();
+
+    /*
+        returns the number of items currently in the table
+        @return an integer representing the number of items currently in the table
+    */
+    size_t itemCount();
+
+    /*
+        returns the item with the specified key; only ever looks in the key's two buckets (and the stash, which is almost always empty)
+        @param key, key of the item to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+        @return the item with the matching key
+    */
+    template <class K>
+    ItemType getValue(const K &key);
+
+    /*
+        checks the table to see if a an item with the specified key exists; only ever looks in the key's two buckets (and the stash, which is almost always empty)
+        @param key, key of the item to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+        @return true if the item exists in the table, and false otherwise
+    */
+    template <class K>
+    bool contains(const K &key);
+
+    /*
+        inserts a batch of items; the buckets of every item in a group of 'BATCH_SIZE_' are prefetched before any of them is inserted, so that their cache misses overlap instead of happening one after another
+        @param items, pointer to the first of the key-value pairs to insert
+        @param count, number of items to insert
+    */
+    void insertBatch(const std::pair<KeyType, ItemType> *items, size_t count);
+
+    /*
+        looks up a batch of keys; every key in a group of 'BATCH_SIZE_' is hashed and its buckets prefetched before any of them is searched for, so that their cache misses overlap instead of happening one after another
+        @param keys, pointer to the first of the keys to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+        @param count, number of keys to search for
+        @param values, array of at least 'count' pointers; each is set to the value of the matching item, or 'nullptr' if no item has that key. The pointers stay valid until the table is next modified
+    */
+    template <class K>
+    void getValues(const K *keys, size_t count, ItemType **values);
+
+    /*
+        prints every item currently in the table
+    */
+    void display();
+private:
+    static const size_t SLOTS_PER_BUCKET_ = 4; //number of items each bucket holds
+    static const size_t MIN_BUCKET_COUNT_ = 4; //initial number of buckets; the table never shrinks below this
+    static const size_t MAX_KICKS_ = 256; //number of items an insert may displace before giving up and using the stash
+    static const size_t STASH_SIZE_ = 8; //number of items the stash holds before the table grows
+    static const size_t BATCH_SIZE_ = 16; //number of keys hashed and prefetched at a time by the batch functions; about as many cache misses as a core can have in flight
+
+    /*
+        a bucket of items; aligned to a cache line, so that a bucket of small items is read with a single cache miss
+    */
+    struct alignas(64) Bucket
+    {
+        uint8_t tags_[SLOTS_PER_BUCKET_]; //8 bits of each item's hash, used to skip most key comparisons; 0 marks an empty slot
+        HashItem<KeyType, ItemType> items_[SLOTS_PER_BUCKET_]; //items stored inline; only slots with a non-zero tag hold a valid item
+    };
+
+    size_t item_count_; //current number of items in the table, including the stash
+    size_t bucket_count_; //number of buckets; always a power of two
+    double max_load_factor_; //the table grows once its load factor exceeds this
+    double min_load_factor_; //the table shrinks once its load factor falls below this
+    Bucket *buckets_; //array of buckets
+    std::vector<HashItem<KeyType, ItemType>> stash_; //items that could not be placed in either of their buckets
+    size_t kick_slot_; //slot to displace on the next kick; advanced on every kick so that inserts do not keep displacing the same items
+    Hasher hasher_; //hash function object; mixes a key into 64 well-distributed bits
+    KeyEqual key_equal_; //key comparison function object; checks if two keys are equal
+
+    /*
+        returns the tag of a hash; taken from the high bits, which are independent of the bucket index
+        @param hash, the full hash of the key
+        @return an integer between 1 and 255
+    */
+    uint8_t tagOf(uint64_t hash);
+
+    /*
+        returns the other bucket an item can be stored in; computed from the bucket and tag alone, so that displaced items can be moved without hashing their keys again
+        @param bucket, index of one of the item's buckets
+        @param tag, the tag of the item
+        @return the index of the item's other bucket; applying this twice gives back the original bucket
+    */
+    size_t alternateBucket(size_t bucket, uint8_t tag);
+
+    /*
+        searches the table for an item with the specified key, using its already computed hash
+        @param key, key of the item to search for
+        @param hash, the full hash of the key
+        @return a pointer to the matching item, or 'nullptr' if the item does not exist
+    */
+    template <class K>
+    HashItem<KeyType, ItemType> *findItem(const K &key, uint64_t hash);
+
+    /*
+        searches the table for an item with the specified key, using its already computed hash
+        @param key, key of the item to search for
+        @param hash, the full hash of the key
+        @return a pointer to the value of the matching item, or 'nullptr' if the item does not exist
+    */
+    template <class K>
+    ItemType *findValue(const K &key, uint64_t hash);
+
+    /*
+        places an item whose key is not in the table yet; when both of its buckets are full, items are displaced ("kicked") to their other bucket until one finds a free slot, and an item that is still left over after 'MAX_KICKS_' goes into the stash
+        @param item, the item to place
+        @param hash, the full hash of the item's key
+        @return true if the stash has grown past 'STASH_SIZE_', meaning the table should grow; the item is placed either way
+    */
+    bool placeItem(HashItem<KeyType, ItemType> item, uint64_t hash);
+
+    /*
+        returns the first free slot of a bucket
+        @param bucket, index of the bucket
+        @return the index of the free slot, or 'SLOTS_PER_BUCKET_' if the bucket is full
+    */
+    size_t freeSlot(size_t bucket);
+
+    /*
+        prefetches both buckets of the specified hash
+        @param hash, the full hash of the key
+    */
+    void prefetchBucket(uint64_t hash);
+
+    /*
+        hints the processor to start loading the cache line holding the specified address
+        @param address, the address to prefetch
+    */
+    void prefetch(const void *address);
+
+    /*
+        returns the load factor of the hash table
+        @return a decimal number representing the current load factor of the table
+    */
+    double loadFactor();
+
+    /*
+        rehashes the table into the specified number of buckets, moving the stash back into the buckets; called when the load factor leaves the limits or the stash overflows, and to presize or shrink the table
+        @param new_count, number of buckets of the new table; a power of two
+    */
+    void rehashTable(size_t new_count);
+
+    /*
+        finds the smallest bucket count that holds the specified number of items without exceeding the maximum load factor
+        @param count, number of items
+        @return the bucket count; a power of two
+    */
+    size_t bucketCountFor(size_t count);
+};
+
+#include "HashTable.cpp"
+#endif
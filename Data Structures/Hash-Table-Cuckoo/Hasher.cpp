@@ -0,0 +1,133 @@
+/*
+Title: Hash Functions
+Author: Edwin Khew
+Description: Hash function (hasher) class implementations.
+Date Created: 10/17/2026
+*/
+
+#include <cstdint>
+#include <cstring> //for std::memcpy
+#include <string_view>
+
+#ifdef __SSE4_2__
+#include <nmmintrin.h> //for the 'crc32' instruction
+#endif
+
+inline uint64_t readChunk(const char *data, size_t length)
+{
+    uint64_t chunk = 0;
+
+    std::memcpy(&chunk, data, length < 8 ? length : 8); //memcpy avoids unaligned reads; compilers turn it into a single load
+
+    return chunk;
+}
+
+inline uint64_t FibonacciHash::operator()(uint64_t key) const
+{
+    uint64_t hash = key * 0x9E3779B97F4A7C15ULL; //2^64 divided by the golden ratio
+
+    //the high half of the product depends on every bit of the key, while the low half only depends on the low bits; fold the high half down so masking still sees all of the key
+    return hash ^ (hash >> 32);
+}
+
+inline uint64_t FibonacciHash::operator()(std::string_view key) const
+{
+    uint64_t hash = key.size(); //start from the length so that strings differing only in trailing zero bytes hash differently
+
+    for(size_t i = 0; i < key.size(); i += 8) //multiply in every 8-byte chunk of the string
+    {
+        hash = (hash ^ readChunk(key.data() + i, key.size() - i)) * 0x9E3779B97F4A7C15ULL;
+        hash ^= hash >> 32;
+    }
+
+    return (*this)(hash); //finish with the integer hash so that short strings are mixed as well as integers
+}
+
+inline uint64_t WyHash::operator()(uint64_t key) const
+{
+    return mix(mix(key ^ 0xA0761D6478BD642FULL, 0xE7037ED1A0B428DBULL), 0x8EBC6AF09C88C6E3ULL);
+}
+
+inline uint64_t WyHash::operator()(std::string_view key) const
+{
+    uint64_t hash = 0xA0761D6478BD642FULL ^ key.size();
+
+    for(size_t i = 0; i < key.size(); i += 8) //mix in every 8-byte chunk of the string
+    {
+        hash = mix(readChunk(key.data() + i, key.size() - i) ^ 0xE7037ED1A0B428DBULL, hash);
+    }
+
+    return mix(hash, 0x8EBC6AF09C88C6E3ULL);
+}
+
+inline uint64_t WyHash::mix(uint64_t a, uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#else
+    //build the 128-bit product out of four 32-bit partial products
+    uint64_t a_low = a & 0xFFFFFFFFULL, a_high = a >> 32;
+    uint64_t b_low = b & 0xFFFFFFFFULL, b_high = b >> 32;
+
+    uint64_t low_low = a_low * b_low;
+    uint64_t high_low = a_high * b_low;
+    uint64_t low_high = a_low * b_high;
+    uint64_t high_high = a_high * b_high;
+
+    uint64_t middle = (low_low >> 32) + (high_low & 0xFFFFFFFFULL) + low_high;
+    uint64_t low = (middle << 32) | (low_low & 0xFFFFFFFFULL);
+    uint64_t high = high_high + (high_low >> 32) + (middle >> 32);
+
+    return low ^ high;
+#endif
+}
+
+inline uint64_t Crc32Hash::operator()(uint64_t key) const
+{
+    return finish(crc32(0x85EBCA6BU, key));
+}
+
+inline uint64_t Crc32Hash::operator()(std::string_view key) const
+{
+    uint32_t crc = 0x85EBCA6BU ^ static_cast<uint32_t>(key.size());
+
+    for(size_t i = 0; i < key.size(); i += 8) //run every 8-byte chunk of the string through the CRC
+    {
+        crc = crc32(crc, readChunk(key.data() + i, key.size() - i));
+    }
+
+    return finish(crc);
+}
+
+inline uint32_t Crc32Hash::crc32(uint32_t crc, uint64_t value)
+{
+#ifdef __SSE4_2__
+    return static_cast<uint32_t>(_mm_crc32_u64(crc, value));
+#else
+    //bitwise CRC32-C (reflected polynomial 0x82F63B78); slower than the instruction but gives the same result
+    uint64_t bits = value;
+
+    for(int i = 0; i < 8; i++) //one byte at a time, lowest byte first
+    {
+        crc ^= static_cast<uint32_t>(bits & 0xFF);
+        bits >>= 8;
+
+        for(int j = 0; j < 8; j++)
+        {
+            crc = (crc >> 1) ^ (0x82F63B78U & (0U - (crc & 1U)));
+        }
+    }
+
+    return crc;
+#endif
+}
+
+inline uint64_t Crc32Hash::finish(uint32_t crc)
+{
+    //the table masks the low bits for the address, and double hashing and the Swiss table also need good high bits; the high half of the product depends on every bit of the CRC, and folding it down mixes it into the low half as well
+    //multiplying by an odd constant and the fold can both be undone, so no two CRCs end up with the same hash
+    uint64_t hash = static_cast<uint64_t>(crc) * 0x9E3779B97F4A7C15ULL;
+
+    return hash ^ (hash >> 32);
+}
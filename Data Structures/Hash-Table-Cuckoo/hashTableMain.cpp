@@ -0,0 +1,123 @@
+/*
+Title: Hash Table (bucketized cuckoo hashing)
+Author: Edwin Khew
+Description: Hash table test file.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <string_view>
+#include "HashItem.hpp"
+#include "Hasher.hpp"
+#include "HashTable.hpp"
+
+using namespace std;
+
+int main()
+{
+    HashTable<int, string> myTable;
+    //HashTable<int, string, FibonacciHash> myTable; //hasher test; other hashers: WyHash (default), Crc32Hash
+
+    myTable.insert(279, "Penny");
+    myTable.insert(298, "Shelly");
+    myTable.insert(264, "Colt");
+    myTable.insert(302, "Spike");
+    myTable.insert(301, "Brock");
+    myTable.insert(287, "Edgar");
+    myTable.insert(289, "Sandy");
+    myTable.insert(304, "Leon");
+    myTable.insert(280, "Bea");
+    myTable.insert(294, "Jessie");
+    myTable.insert(295, "Tara");
+    myTable.insert(334, "Rosa");
+    myTable.insert(292, "Crow");
+    myTable.insert(300, "Lou");
+
+    //myTable.remove(301);
+
+    myTable.insert(279, "Penny (Updated)"); //existing key; replaces the value instead of adding a duplicate
+
+    //Clustering test
+/*
+    myTable.insert(3, "A");
+    myTable.insert(14, "B");
+    myTable.insert(25, "C");
+    myTable.insert(36, "D");
+    myTable.insert(47, "E");
+    myTable.insert(58, "G");
+*/
+
+    cout << "Is Empty: " << myTable.isEmpty() << endl;
+    cout << "Item Count: " << myTable.itemCount() << endl;
+    cout << "Contains: " << myTable.contains(301) << endl;
+
+    try
+    {
+        cout << "Get Value: " << myTable.getValue(279) << endl;
+    }
+    catch(const std::out_of_range& problem)
+    {
+        cout << "Item not found!" << endl;
+    }
+
+    cout << "Display: " << endl << endl;
+    myTable.display();
+
+    myTable.clear();
+
+    cout << endl << "Is Empty (After clear): " << myTable.isEmpty() << endl;
+    cout << "Item Count (After clear): " << myTable.itemCount() << endl;
+    cout << "Display (After clear): " << endl << endl;
+    myTable.display();
+
+    /*
+        batch test; inserts and looks up several items at once
+    */
+    pair<int, string> myBatch[] = {{279, "Penny"}, {298, "Shelly"}, {264, "Colt"}};
+    myTable.insertBatch(myBatch, 3);
+
+    int myKeys[] = {279, 264, 301};
+    string *myValues[3];
+    myTable.getValues(myKeys, 3, myValues);
+
+    for(int i = 0; i < 3; i++)
+    {
+        cout << endl << "Get Values (" << myKeys[i] << "): " << (myValues[i] != nullptr ? *myValues[i] : "Item not found!");
+    }
+
+    cout << endl;
+
+    /*
+        capacity test; presizes the table so that a bulk load does not rehash, then shrinks it back down once the items are gone
+    */
+    myTable.clear();
+    myTable.setMaxLoadFactor(0.5);
+    myTable.reserve(1000);
+
+    for(int i = 0; i < 1000; i++)
+    {
+        myTable.insert(i, "Item");
+    }
+
+    cout << endl << "Max Load Factor: " << myTable.maxLoadFactor() << endl;
+    cout << "Item Count (After reserve): " << myTable.itemCount() << endl;
+
+    myTable.clear();
+    myTable.shrinkToFit();
+
+    cout << "Item Count (After shrink): " << myTable.itemCount() << endl;
+
+    /*
+        string key test; looks up std::string keys with std::string_view keys, which does not copy the key into a std::string
+    */
+    HashTable<string, int> myStringTable;
+
+    myStringTable.insert("Penny", 279);
+    myStringTable.insert("Shelly", 298);
+    myStringTable.insert("Colt", 264);
+
+    string_view name = "Shelly";
+
+    cout << endl << "Contains (string_view): " << myStringTable.contains(name) << endl;
+    cout << "Get Value (string_view): " << myStringTable.getValue(name) << endl;
+}
@@ -5,32 +5,38 @@ Description: Hash item class implementation.
 Date Created: 6/27/2021
 */
 
-template<typename ItemType>
-HashItem<ItemType>::HashItem() { }
+template<typename KeyType, typename ItemType>
+HashItem<KeyType, ItemType>::HashItem() { }
 
-template<typename ItemType>
-HashItem<ItemType>::HashItem(int key, const ItemType value):key_(key), value_(value) { }
+template<typename KeyType, typename ItemType>
+HashItem<KeyType, ItemType>::HashItem(const KeyType &key, const ItemType value):key_(key), value_(value) { }
 
-template<typename ItemType>
-void HashItem<ItemType>::setKey(int key)
+template<typename KeyType, typename ItemType>
+void HashItem<KeyType, ItemType>::setKey(const KeyType &key)
 {
     key_ = key;
 }
 
-template<typename ItemType>
-void HashItem<ItemType>::setValue(const ItemType value)
+template<typename KeyType, typename ItemType>
+void HashItem<KeyType, ItemType>::setValue(const ItemType value)
 {
     value_ = value;
 }
 
-template<typename ItemType>
-int HashItem<ItemType>::getKey() const
+template<typename KeyType, typename ItemType>
+const KeyType &HashItem<KeyType, ItemType>::getKey() const
 {
     return key_;
 }
 
-template<typename ItemType>
-ItemType HashItem<ItemType>::getValue() const
+template<typename KeyType, typename ItemType>
+ItemType HashItem<KeyType, ItemType>::getValue() const
 {
     return value_;
 }
+
+template<typename KeyType, typename ItemType>
+ItemType *HashItem<KeyType, ItemType>::getValuePointer()
+{
+    return &value_;
+}
@@ -6,58 +6,100 @@ Date Created: 7/3/2021
 */
 
 #include <list>
+#include <stdexcept> //for std::invalid_argument
 
-template<typename ItemType>
-HashTable<ItemType>::HashTable():item_count_(0), table_size_(11)
+#ifdef HASH_TABLE_STATS
+#include <algorithm> //for std::max
+#include <chrono> //for timing rehashes
+#endif
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+HashTable<KeyType, ItemType, Hasher, KeyEqual>::HashTable():item_count_(0), tombstone_count_(0), table_size_(MIN_TABLE_SIZE_), max_load_factor_(0.7), min_load_factor_(0.1)
 {
-    hash_table_ = new HashItem<ItemType> *[table_size_];
+    hash_table_ = new HashSlot<KeyType, ItemType>[table_size_];
+    slot_state_ = new uint8_t[table_size_];
 
-//set each index to 'nullptr'
-    for(int i = 0; i < table_size_; i++)
+    //mark each index as empty
+    for(size_t i = 0; i < table_size_; i++)
     {
-        hash_table_[i] = nullptr;
+        slot_state_[i] = EMPTY_;
     }
 }
 
-template<typename ItemType>
-void HashTable<ItemType>::insert(int key, ItemType value)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+HashTable<KeyType, ItemType, Hasher, KeyEqual>::~HashTable()
 {
-    int hash1 = hashFunction1(key); //hash the key to get its address
-    int hash2 = hashFunction2(key); //hash the key to get a value to increment with when collision occurs
-    int i = 0; //used for incrementing when collision occurs
+    clear();
+
+    delete[] hash_table_;
+    delete[] slot_state_;
+    hash_table_ = nullptr;
+    slot_state_ = nullptr;
+}
 
-    HashItem<ItemType> *new_item = new HashItem<ItemType>(key, value); //create a new hash item (key-value pair)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::insert(const KeyType &key, ItemType value)
+{
+    uint64_t hash = hasher_(key); //hash the key once; both hash functions use different bits of it
+    size_t hash1 = hashFunction1(hash); //get the address of the key
+    size_t hash2 = hashFunction2(hash); //get a value to increment with when collision occurs
+    size_t i = 0; //used for incrementing when collision occurs
 
-    //insert at the first available (i * hash2)'th index found in the i'th iteration
-    while(hash_table_[(hash1 + i * hash2) % table_size_] != nullptr)
+    //insert at the first empty or deleted (i * hash2)'th index found in the i'th iteration; a deleted slot can be reused, since it is part of a probe sequence either way
+    while(slot_state_[(hash1 + i * hash2) & (table_size_ - 1)] == FULL_)
     {
         i++;
     }
 
-    hash_table_[(hash1 + i * hash2) % table_size_] = new_item;
+    if(slot_state_[(hash1 + i * hash2) & (table_size_ - 1)] == TOMBSTONE_) //reusing a deleted slot
+    {
+        tombstone_count_--;
+    }
+
+    hash_table_[(hash1 + i * hash2) & (table_size_ - 1)].construct(key, value); //create the new hash item (key-value pair) in the slot; small items need no allocation
+    slot_state_[(hash1 + i * hash2) & (table_size_ - 1)] = FULL_;
 
     item_count_++;
 
-    //if the load factor exceeds the specified limit after insertion of the new item, expand and rehash the table
-    if(loadFactor() > 0.7)
+    //if the load factor (counting deleted slots, which lengthen probe sequences just like items do) exceeds the specified limit after insertion of the new item, rehash the table
+    //the table only grows if the items themselves fill more than half of the limit; otherwise most of the used slots are deleted, and rebuilding at the same size is enough
+    if((1.0 * (item_count_ + tombstone_count_)) / table_size_ > max_load_factor_)
     {
-        rehashTable();
+        rehashTable((item_count_ > table_size_ * max_load_factor_ / 2) ? 2 * table_size_ : table_size_);
     }
 }
 
-template<typename ItemType>
-void HashTable<ItemType>::remove(int key)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::remove(const K &key)
 {
-    int hash1 = hashFunction1(key); //hash the key to get its address
-    int hash2 = hashFunction2(key); //hash the key to get a value to increment with when collision occurs
-    int i = 0; //used for incrementing when collision occurs
+    uint64_t hash = hasher_(key); //hash the key once; both hash functions use different bits of it
+    size_t hash1 = hashFunction1(hash); //get the address of the key
+    size_t hash2 = hashFunction2(hash); //get a value to increment with when collision occurs
+    size_t i = 0; //used for incrementing when collision occurs
 
-    while(hash_table_[(hash1 + i * hash2) % table_size_] != nullptr) //checks all consecutive items until an empty index is reached; when an empty index is reached, then the item does not exist
+    while(slot_state_[(hash1 + i * hash2) & (table_size_ - 1)] != EMPTY_) //checks all consecutive items until an empty index is reached; when an empty index is reached, then the item does not exist (deleted slots do not end the search)
     {
         //when an item with a matching key is found, remove it
-        if(hash_table_[(hash1 + i * hash2) % table_size_]->getKey() == key)
+        if(slot_state_[(hash1 + i * hash2) & (table_size_ - 1)] == FULL_ && key_equal_(hash_table_[(hash1 + i * hash2) & (table_size_ - 1)].getItem().getKey(), key))
         {
-            hash_table_[(hash1 + i * hash2) % table_size_] = nullptr;
+            hash_table_[(hash1 + i * hash2) & (table_size_ - 1)].destroy();
+            slot_state_[(hash1 + i * hash2) & (table_size_ - 1)] = TOMBSTONE_; //mark the slot as deleted rather than empty; emptying it would end the probe sequences of keys stored past it
+
+            item_count_--;
+            tombstone_count_++;
+
+            //if the load factor falls below the specified limit after removal of the item, shrink and rehash the table
+            if(loadFactor() < min_load_factor_ && table_size_ > MIN_TABLE_SIZE_)
+            {
+                rehashTable(table_size_ / 2);
+            }
+            //otherwise, once too many slots are deleted, rebuild the table at the same size to drop the tombstones; this takes at least 'MAX_TOMBSTONE_RATIO_' * 'table_size_' removals to trigger, so it costs O(1) amortized per removal
+            else if(tombstone_count_ > table_size_ * MAX_TOMBSTONE_RATIO_)
+            {
+                rehashTable(table_size_);
+            }
+
             break;
         }
 
@@ -65,42 +107,108 @@ void HashTable<ItemType>::remove(int key)
     }
 }
 
-template<typename ItemType>
-void HashTable<ItemType>::clear()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::clear()
 {
-    for(int i = 0; i < table_size_; i++) //loop through each index of the array
+    for(size_t i = 0; i < table_size_; i++) //loop through each index of the array
     {
-        hash_table_[i] = nullptr;
+        if(slot_state_[i] == FULL_)
+        {
+            hash_table_[i].destroy();
+        }
+
+        slot_state_[i] = EMPTY_;
     }
 
     item_count_ = 0;
+    tombstone_count_ = 0;
 }
 
-template<typename ItemType>
-bool HashTable<ItemType>::isEmpty()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::reserve(size_t count)
+{
+    size_t new_size = tableSizeFor(count);
+
+    if(new_size > table_size_)
+    {
+        rehashTable(new_size);
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::shrinkToFit()
+{
+    size_t new_size = tableSizeFor(item_count_);
+
+    if(new_size < table_size_ || tombstone_count_ > 0) //rebuilding at the same size still drops the tombstones
+    {
+        rehashTable(new_size);
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+double HashTable<KeyType, ItemType, Hasher, KeyEqual>::maxLoadFactor()
+{
+    return max_load_factor_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::setMaxLoadFactor(double load_factor)
+{
+    if(!(load_factor > 0 && load_factor < 1) || load_factor <= 2 * min_load_factor_)
+    {
+        throw(std::invalid_argument("Load factor out of range!"));
+    }
+
+    max_load_factor_ = load_factor;
+
+    reserve(item_count_); //grow the table if it is now over the limit
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+double HashTable<KeyType, ItemType, Hasher, KeyEqual>::minLoadFactor()
+{
+    return min_load_factor_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::setMinLoadFactor(double load_factor)
+{
+    if(!(load_factor >= 0) || 2 * load_factor >= max_load_factor_)
+    {
+        throw(std::invalid_argument("Load factor out of range!"));
+    }
+
+    min_load_factor_ = load_factor;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+bool HashTable<KeyType, ItemType, Hasher, KeyEqual>::isEmpty()
 {
     return item_count_ == 0;
 }
 
-template<typename ItemType>
-size_t HashTable<ItemType>::itemCount()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::itemCount()
 {
     return item_count_;
 }
 
-template<typename ItemType>
-ItemType HashTable<ItemType>::getValue(int key)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+ItemType HashTable<KeyType, ItemType, Hasher, KeyEqual>::getValue(const K &key)
 {
-    int hash1 = hashFunction1(key); //hash the key to get its address
-    int hash2 = hashFunction2(key); //hash the key to get a value to increment with when collision occurs
-    int i = 0; //used for incrementing when collision occurs
+    uint64_t hash = hasher_(key); //hash the key once; both hash functions use different bits of it
+    size_t hash1 = hashFunction1(hash); //get the address of the key
+    size_t hash2 = hashFunction2(hash); //get a value to increment with when collision occurs
+    size_t i = 0; //used for incrementing when collision occurs
 
-    while(hash_table_[(hash1 + i * hash2) % table_size_] != nullptr)
+    while(slot_state_[(hash1 + i * hash2) & (table_size_ - 1)] != EMPTY_)
     {
         //when an item with a matching key is found, return its value
-        if(hash_table_[(hash1 + i * hash2) % table_size_]->getKey() == key)
+        if(slot_state_[(hash1 + i * hash2) & (table_size_ - 1)] == FULL_ && key_equal_(hash_table_[(hash1 + i * hash2) & (table_size_ - 1)].getItem().getKey(), key))
         {
-            return hash_table_[(hash1 + i * hash2) % table_size_]->getValue();
+            return hash_table_[(hash1 + i * hash2) & (table_size_ - 1)].getItem().getValue();
         }
 
         i++;
@@ -110,17 +218,19 @@ ItemType HashTable<ItemType>::getValue(int key)
     throw(std::out_of_range("Position out of range!"));
 }
 
-template<typename ItemType>
-bool HashTable<ItemType>::contains(int key)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+bool HashTable<KeyType, ItemType, Hasher, KeyEqual>::contains(const K &key)
 {
-    int hash1 = hashFunction1(key); //hash the key to get its address
-    int hash2 = hashFunction2(key); //hash the key to get a value to increment with when collision occurs
-    int i = 0; //used for incrementing when collision occurs
+    uint64_t hash = hasher_(key); //hash the key once; both hash functions use different bits of it
+    size_t hash1 = hashFunction1(hash); //get the address of the key
+    size_t hash2 = hashFunction2(hash); //get a value to increment with when collision occurs
+    size_t i = 0; //used for incrementing when collision occurs
 
-    while(hash_table_[(hash1 + i * hash2) % table_size_] != nullptr)
+    while(slot_state_[(hash1 + i * hash2) & (table_size_ - 1)] != EMPTY_)
     {
         //when an item with a matching key is found, return true
-        if(hash_table_[(hash1 + i * hash2) % table_size_]->getKey() == key)
+        if(slot_state_[(hash1 + i * hash2) & (table_size_ - 1)] == FULL_ && key_equal_(hash_table_[(hash1 + i * hash2) & (table_size_ - 1)].getItem().getKey(), key))
         {
             return true;
         }
@@ -132,61 +242,263 @@ bool HashTable<ItemType>::contains(int key)
     return false;
 }
 
-template<typename ItemType>
-void HashTable<ItemType>::display()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::insertBatch(const std::pair<KeyType, ItemType> *items, size_t count)
+{
+    for(size_t start = 0; start < count; start += BATCH_SIZE_)
+    {
+        size_t end = (start + BATCH_SIZE_ < count) ? start + BATCH_SIZE_ : count; //one past the last item of the group
+
+        //prefetch the bucket of every item in the group first
+        for(size_t i = start; i < end; i++)
+        {
+            prefetchBucket(hasher_(items[i].first));
+        }
+
+        //then insert them; by now most of their buckets are already in the cache
+        for(size_t i = start; i < end; i++)
+        {
+            insert(items[i].first, items[i].second);
+        }
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::getValues(const K *keys, size_t count, ItemType **values)
+{
+    uint64_t hashes[BATCH_SIZE_]; //hashes of the current group of keys
+
+    for(size_t start = 0; start < count; start += BATCH_SIZE_)
+    {
+        size_t end = (start + BATCH_SIZE_ < count) ? start + BATCH_SIZE_ : count; //one past the last key of the group
+
+        //hash every key in the group and prefetch its bucket first
+        for(size_t i = start; i < end; i++)
+        {
+            hashes[i - start] = hasher_(keys[i]);
+            prefetchBucket(hashes[i - start]);
+        }
+
+        //then search for them; by now most of their buckets are already in the cache
+        for(size_t i = start; i < end; i++)
+        {
+            values[i] = findValue(keys[i], hashes[i - start]);
+        }
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::display()
 {
     for(int i = 0; i < table_size_; i++)
     {
-        if(hash_table_[i] == nullptr)
+        if(slot_state_[i] != FULL_) //empty or deleted slot
         {
             std::cout << i << " " << std::endl;
         }
         else
         {
-            std::cout << i << " " << hash_table_[i]->getValue() << std::endl;
+            std::cout << i << " " << hash_table_[i].getItem().getValue() << std::endl;
         }
     }
 }
 
-template<typename ItemType>
-int HashTable<ItemType>::hashFunction1(int key)
+#ifdef HASH_TABLE_STATS
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+HashTableStats HashTable<KeyType, ItemType, Hasher, KeyEqual>::stats()
+{
+    HashTableStats stats;
+
+    stats.item_count_ = item_count_;
+    stats.table_size_ = table_size_;
+    stats.load_factor_ = loadFactor();
+    stats.max_probe_length_ = 0;
+    stats.max_chain_length_ = 0;
+    stats.rehash_count_ = rehash_count_;
+    stats.rehash_seconds_ = rehash_seconds_;
+    stats.tombstone_ratio_ = (1.0 * tombstone_count_) / table_size_;
+
+    //count how many probes past its home slot each item sits
+    for(size_t i = 0; i < table_size_; i++)
+    {
+        if(slot_state_[i] == FULL_)
+        {
+            size_t probes = 0;
+            uint64_t hash = hasher_(hash_table_[i].getItem().getKey());
+            size_t hash1 = hashFunction1(hash);
+            size_t hash2 = hashFunction2(hash);
+
+            //walk the item's probe sequence until it reaches the slot holding the item
+            while(((hash1 + probes * hash2) & (table_size_ - 1)) != i)
+            {
+                probes++;
+            }
+
+            if(probes >= stats.probe_histogram_.size())
+            {
+                stats.probe_histogram_.resize(probes + 1, 0);
+            }
+
+            stats.probe_histogram_[probes]++;
+            stats.max_probe_length_ = std::max(stats.max_probe_length_, probes);
+        }
+    }
+
+    //find the longest run of occupied slots (deleted slots included, since probing walks through them too); start just past an empty slot so that a run wrapping around the end of the table is counted once
+    size_t start = 0;
+
+    while(start < table_size_ && slot_state_[start] != EMPTY_)
+    {
+        start++;
+    }
+
+    size_t run = 0;
+
+    for(size_t i = 1; i <= table_size_; i++)
+    {
+        run = (slot_state_[(start + i) & (table_size_ - 1)] != EMPTY_) ? run + 1 : 0;
+        stats.max_chain_length_ = std::max(stats.max_chain_length_, run);
+    }
+
+    size_t bytes = table_size_ * (sizeof(HashSlot<KeyType, ItemType>) + sizeof(uint8_t)) + (HashSlot<KeyType, ItemType>::isInline() ? 0 : item_count_ * sizeof(HashItem<KeyType, ItemType>)); //out-of-line items are allocated on top of their slots
+    stats.bytes_per_entry_ = (item_count_ > 0) ? (1.0 * bytes) / item_count_ : 0;
+
+    return stats;
+}
+#endif
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::hashFunction1(uint64_t hash)
 {
-    return key % table_size_;
+    return hash & (table_size_ - 1); //table size is a power of two, so masking the low bits replaces the modulo
 }
 
-template<typename ItemType>
-int HashTable<ItemType>::hashFunction2(int key)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::hashFunction2(uint64_t hash)
 {
-    return 7 - (key % 7);
+    return ((hash >> 32) & (table_size_ - 1)) | 1; //odd increments are coprime with a power-of-two table size, so the probe sequence visits every index
 }
 
-template<typename ItemType>
-double HashTable<ItemType>::loadFactor()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+double HashTable<KeyType, ItemType, Hasher, KeyEqual>::loadFactor()
 {
     return (1.0 * item_count_) / table_size_;
 }
 
-template<typename ItemType>
-void HashTable<ItemType>::rehashTable()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::tableSizeFor(size_t count)
 {
-    HashItem<ItemType> **temp = hash_table_; //create a temporary copy of the old table
+    size_t size = MIN_TABLE_SIZE_;
+
+    //double the table size until the items fit without exceeding the maximum load factor
+    while(count > size * max_load_factor_)
+    {
+        size = 2 * size;
+    }
+
+    return size;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::rehashTable(size_t new_size)
+{
+#ifdef HASH_TABLE_STATS
+    auto rehash_start = std::chrono::steady_clock::now();
+#endif
+
+    HashSlot<KeyType, ItemType> *temp = hash_table_; //create a temporary copy of the old table
+    uint8_t *temp_state = slot_state_; //create a temporary copy of the old slot states
 
     size_t temp_size = table_size_; //create a temporary copy of the old table size
-    table_size_ = 2 * table_size_; //increase the table size
-    item_count_ = 0; //reset the item count
+    table_size_ = new_size;
+    tombstone_count_ = 0;
 
-    hash_table_ = new HashItem<ItemType> *[table_size_]; //create a new array of pointers with the increased size
+    hash_table_ = new HashSlot<KeyType, ItemType>[table_size_]; //create a new array of slots with the new size
+    slot_state_ = new uint8_t[table_size_];
 
-    //loop through the temporary copy and insert each item into the new table
-    for(int i = 0; i < temp_size; i++)
+    //mark each index of the new array as empty
+    for(size_t i = 0; i < table_size_; i++)
     {
-        if(temp[i] != nullptr)
+        slot_state_[i] = EMPTY_;
+    }
+
+    //loop through the temporary copy and place each existing item into the new table; slots are copied as they are, so inline items are moved with a plain copy, out-of-line items are not reallocated, and tombstones are left behind
+    for(size_t i = 0; i < temp_size; i++)
+    {
+        if(temp_state[i] == FULL_)
         {
-            insert(temp[i]->getKey(), temp[i]->getValue());
+            placeItem(temp[i]);
         }
     }
 
     //delete the old table and free memory
     delete[] temp;
+    delete[] temp_state;
     temp = nullptr;
+    temp_state = nullptr;
+
+#ifdef HASH_TABLE_STATS
+    rehash_count_++;
+    rehash_seconds_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - rehash_start).count();
+#endif
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::placeItem(HashSlot<KeyType, ItemType> slot)
+{
+    uint64_t hash = hasher_(slot.getItem().getKey()); //hash the key once; both hash functions use different bits of it
+    size_t hash1 = hashFunction1(hash); //get the address of the key
+    size_t hash2 = hashFunction2(hash); //get a value to increment with when collision occurs
+    size_t i = 0; //used for incrementing when collision occurs
+
+    while(slot_state_[(hash1 + i * hash2) & (table_size_ - 1)] != EMPTY_)
+    {
+        i++;
+    }
+
+    hash_table_[(hash1 + i * hash2) & (table_size_ - 1)] = slot;
+    slot_state_[(hash1 + i * hash2) & (table_size_ - 1)] = FULL_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+ItemType *HashTable<KeyType, ItemType, Hasher, KeyEqual>::findValue(const K &key, uint64_t hash)
+{
+    size_t hash1 = hashFunction1(hash); //get the address of the key
+    size_t hash2 = hashFunction2(hash); //get a value to increment with when collision occurs
+    size_t i = 0; //used for incrementing when collision occurs
+
+    while(slot_state_[(hash1 + i * hash2) & (table_size_ - 1)] != EMPTY_)
+    {
+        //when an item with a matching key is found, return a pointer to its value
+        if(slot_state_[(hash1 + i * hash2) & (table_size_ - 1)] == FULL_ && key_equal_(hash_table_[(hash1 + i * hash2) & (table_size_ - 1)].getItem().getKey(), key))
+        {
+            return hash_table_[(hash1 + i * hash2) & (table_size_ - 1)].getItem().getValuePointer();
+        }
+
+        i++;
+    }
+
+    //if no matching key was found, return 'nullptr'
+    return nullptr;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::prefetchBucket(uint64_t hash)
+{
+    size_t address = hashFunction1(hash);
+
+    prefetch(hash_table_ + address);
+    prefetch(slot_state_ + address);
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::prefetch(const void *address)
+{
+#if defined(__GNUC__)
+    __builtin_prefetch(address);
+#else
+    (void)address; //no portable prefetch; the batch functions still work, just without the overlap
+#endif
 }
@@ -6,173 +6,465 @@ Date Created: 6/30/2021
 */
 
 #include <list>
+#include <utility> //for std::swap
+#include <stdexcept> //for std::invalid_argument
 
-template<typename ItemType>
-HashTable<ItemType>::HashTable():item_count_(0), table_size_(11)
+#ifdef HASH_TABLE_STATS
+#include <algorithm> //for std::max
+#include <chrono> //for timing rehashes
+#endif
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+HashTable<KeyType, ItemType, Hasher, KeyEqual>::HashTable():item_count_(0), table_size_(MIN_TABLE_SIZE_), max_load_factor_(0.9), min_load_factor_(0.1)
 {
-    hash_table_ = new HashItem<ItemType> *[table_size_];
+    hash_table_ = new HashSlot<KeyType, ItemType>[table_size_];
+    probe_distance_ = new uint32_t[table_size_];
 
-    //set each index to 'nullptr'
-    for(int i = 0; i < table_size_; i++)
+    //mark each index as empty
+    for(size_t i = 0; i < table_size_; i++)
     {
-        hash_table_[i] = nullptr;
+        probe_distance_[i] = EMPTY_;
     }
 }
 
-template<typename ItemType>
-void HashTable<ItemType>::insert(int key, ItemType value)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+HashTable<KeyType, ItemType, Hasher, KeyEqual>::~HashTable()
 {
-    int address = hashFunction(key); //hash the key to get its address
+    clear();
 
-    HashItem<ItemType> *new_item = new HashItem<ItemType>(key, value); //create a new hash item (key-value pair)
+    delete[] hash_table_;
+    delete[] probe_distance_;
+    hash_table_ = nullptr;
+    probe_distance_ = nullptr;
+}
 
-    //insert at the first available index found
-    while(hash_table_[address] != nullptr)
-    {
-        address = (address + 1) % table_size_; //increment the index
-    }
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::insert(const KeyType &key, ItemType value)
+{
+    HashSlot<KeyType, ItemType> new_slot;
+    new_slot.construct(key, value); //create a new hash item (key-value pair); small items need no allocation
 
-    hash_table_[address] = new_item;
+    placeItem(new_slot);
 
     item_count_++;
 
-    //if the load factor exceeds the specified limit after insertion of the new item, expand and rehash the table
-    if(loadFactor() > 0.7)
+    //if the load factor exceeds the specified limit after insertion of the new item, expand and rehash the table; Robin Hood probing keeps probe sequences short enough to run much fuller than plain linear probing
+    if(loadFactor() > max_load_factor_)
     {
-        rehashTable();
+        rehashTable(2 * table_size_);
     }
 }
 
-template<typename ItemType>
-void HashTable<ItemType>::remove(int key)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::remove(const K &key)
 {
-    int address = hashFunction(key); //hash the key to get its address
+    size_t address = findIndex(key);
+
+    if(address == table_size_) //item does not exist
+    {
+        return;
+    }
+
+    hash_table_[address].destroy();
+
+    size_t next = (address + 1) & (table_size_ - 1);
+
+    //backward-shift deletion; shift every following item that is not in its home slot back by one, so that no tombstone is needed and probe sequences stay unbroken
+    while(probe_distance_[next] != EMPTY_ && probe_distance_[next] > 0)
+    {
+        hash_table_[address] = hash_table_[next];
+        probe_distance_[address] = probe_distance_[next] - 1;
+
+        address = next;
+        next = (next + 1) & (table_size_ - 1); //increment the index, wrapping around to the start
+    }
+
+    probe_distance_[address] = EMPTY_;
+
+    item_count_--;
+
+    //if the load factor falls below the specified limit after removal of the item, shrink and rehash the table
+    if(loadFactor() < min_load_factor_ && table_size_ > MIN_TABLE_SIZE_)
+    {
+        rehashTable(table_size_ / 2);
+    }
+}
 
-    while(hash_table_[address] != nullptr) //checks all consecutive items until an empty index is reached; when an empty index is reached, then the item does not exist
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::clear()
+{
+    for(size_t i = 0; i < table_size_; i++) //loop through each index of the array
     {
-        //when an item with a matching key is found, remove it
-        if(hash_table_[address]->getKey() == key)
+        if(probe_distance_[i] != EMPTY_)
         {
-            hash_table_[address] = nullptr;
-            break;
+            hash_table_[i].destroy();
+            probe_distance_[i] = EMPTY_;
         }
+    }
 
-        address = (address + 1) % table_size_; //increment the index
+    item_count_ = 0;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::reserve(size_t count)
+{
+    size_t new_size = tableSizeFor(count);
+
+    if(new_size > table_size_)
+    {
+        rehashTable(new_size);
     }
 }
 
-template<typename ItemType>
-void HashTable<ItemType>::clear()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::shrinkToFit()
 {
-    for(int i = 0; i < table_size_; i++) //loop through each index of the array
+    size_t new_size = tableSizeFor(item_count_);
+
+    if(new_size < table_size_)
     {
-        hash_table_[i] = nullptr;
+        rehashTable(new_size);
     }
+}
 
-    item_count_ = 0;
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+double HashTable<KeyType, ItemType, Hasher, KeyEqual>::maxLoadFactor()
+{
+    return max_load_factor_;
 }
 
-template<typename ItemType>
-bool HashTable<ItemType>::isEmpty()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::setMaxLoadFactor(double load_factor)
+{
+    if(!(load_factor > 0 && load_factor < 1) || load_factor <= 2 * min_load_factor_)
+    {
+        throw(std::invalid_argument("Load factor out of range!"));
+    }
+
+    max_load_factor_ = load_factor;
+
+    reserve(item_count_); //grow the table if it is now over the limit
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+double HashTable<KeyType, ItemType, Hasher, KeyEqual>::minLoadFactor()
+{
+    return min_load_factor_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::setMinLoadFactor(double load_factor)
+{
+    if(!(load_factor >= 0) || 2 * load_factor >= max_load_factor_)
+    {
+        throw(std::invalid_argument("Load factor out of range!"));
+    }
+
+    min_load_factor_ = load_factor;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+bool HashTable<KeyType, ItemType, Hasher, KeyEqual>::isEmpty()
 {
     return item_count_ == 0;
 }
 
-template<typename ItemType>
-size_t HashTable<ItemType>::itemCount()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::itemCount()
 {
     return item_count_;
 }
 
-template<typename ItemType>
-ItemType HashTable<ItemType>::getValue(int key)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+ItemType HashTable<KeyType, ItemType, Hasher, KeyEqual>::getValue(const K &key)
 {
-    int address = hashFunction(key); //hash the key to get its address
+    size_t address = findIndex(key);
 
-    while(hash_table_[address] != nullptr)
+    if(address != table_size_) //when an item with a matching key is found, return its value
     {
-        //when an item with a matching key is found, return its value
-        if(hash_table_[address]->getKey() == key)
-        {
-            return hash_table_[address]->getValue();
-        }
-
-        address = (address + 1) % table_size_; //increment the index
+        return hash_table_[address].getItem().getValue();
     }
 
     //if no matching key was found, throw an exception
     throw(std::out_of_range("Position out of range!"));
 }
 
-template<typename ItemType>
-bool HashTable<ItemType>::contains(int key)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+bool HashTable<KeyType, ItemType, Hasher, KeyEqual>::contains(const K &key)
 {
-    int address = hashFunction(key); //hash the key to get its address
+    return findIndex(key) != table_size_;
+}
 
-    while(hash_table_[address] != nullptr)
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::insertBatch(const std::pair<KeyType, ItemType> *items, size_t count)
+{
+    for(size_t start = 0; start < count; start += BATCH_SIZE_)
     {
-        //when an item with a matching key is found, return true
-        if(hash_table_[address]->getKey() == key)
+        size_t end = (start + BATCH_SIZE_ < count) ? start + BATCH_SIZE_ : count; //one past the last item of the group
+
+        //prefetch the bucket of every item in the group first
+        for(size_t i = start; i < end; i++)
         {
-            return true;
+            prefetchBucket(hasher_(items[i].first));
         }
 
-        address = (address + 1) % table_size_; //increment the index
+        //then insert them; by now most of their buckets are already in the cache
+        for(size_t i = start; i < end; i++)
+        {
+            insert(items[i].first, items[i].second);
+        }
     }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::getValues(const K *keys, size_t count, ItemType **values)
+{
+    uint64_t hashes[BATCH_SIZE_]; //hashes of the current group of keys
 
-    //if no matching key was found, return false
-    return false;
+    for(size_t start = 0; start < count; start += BATCH_SIZE_)
+    {
+        size_t end = (start + BATCH_SIZE_ < count) ? start + BATCH_SIZE_ : count; //one past the last key of the group
+
+        //hash every key in the group and prefetch its bucket first
+        for(size_t i = start; i < end; i++)
+        {
+            hashes[i - start] = hasher_(keys[i]);
+            prefetchBucket(hashes[i - start]);
+        }
+
+        //then search for them; by now most of their buckets are already in the cache
+        for(size_t i = start; i < end; i++)
+        {
+            values[i] = findValue(keys[i], hashes[i - start]);
+        }
+    }
 }
 
-template<typename ItemType>
-void HashTable<ItemType>::display()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::display()
 {
-    for(int i = 0; i < table_size_; i++)
+    for(size_t i = 0; i < table_size_; i++)
     {
-        if(hash_table_[i] == nullptr)
+        if(probe_distance_[i] == EMPTY_)
         {
             std::cout << i << " " << std::endl;
         }
         else
         {
-            std::cout << i << " " << hash_table_[i]->getValue() << std::endl;
+            std::cout << i << " " << hash_table_[i].getItem().getValue() << " (" << probe_distance_[i] << ")" << std::endl; //print the value along with its distance from its home slot
         }
     }
 }
 
-template<typename ItemType>
-int HashTable<ItemType>::hashFunction(int key)
+#ifdef HASH_TABLE_STATS
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+HashTableStats HashTable<KeyType, ItemType, Hasher, KeyEqual>::stats()
 {
-    return key % table_size_;
+    HashTableStats stats;
+
+    stats.item_count_ = item_count_;
+    stats.table_size_ = table_size_;
+    stats.load_factor_ = loadFactor();
+    stats.max_probe_length_ = 0;
+    stats.max_chain_length_ = 0;
+    stats.rehash_count_ = rehash_count_;
+    stats.rehash_seconds_ = rehash_seconds_;
+    stats.tombstone_ratio_ = 0;
+
+    //count how many probes past its home slot each item sits
+    for(size_t i = 0; i < table_size_; i++)
+    {
+        if(probe_distance_[i] != EMPTY_)
+        {
+            size_t probes = probe_distance_[i];
+
+            if(probes >= stats.probe_histogram_.size())
+            {
+                stats.probe_histogram_.resize(probes + 1, 0);
+            }
+
+            stats.probe_histogram_[probes]++;
+            stats.max_probe_length_ = std::max(stats.max_probe_length_, probes);
+        }
+    }
+
+    //find the longest run of occupied slots; start just past an empty slot so that a run wrapping around the end of the table is counted once
+    size_t start = 0;
+
+    while(start < table_size_ && probe_distance_[start] != EMPTY_)
+    {
+        start++;
+    }
+
+    size_t run = 0;
+
+    for(size_t i = 1; i <= table_size_; i++)
+    {
+        run = (probe_distance_[(start + i) & (table_size_ - 1)] != EMPTY_) ? run + 1 : 0;
+        stats.max_chain_length_ = std::max(stats.max_chain_length_, run);
+    }
+
+    size_t bytes = table_size_ * (sizeof(HashSlot<KeyType, ItemType>) + sizeof(uint32_t)) + (HashSlot<KeyType, ItemType>::isInline() ? 0 : item_count_ * sizeof(HashItem<KeyType, ItemType>)); //out-of-line items are allocated on top of their slots
+    stats.bytes_per_entry_ = (item_count_ > 0) ? (1.0 * bytes) / item_count_ : 0;
+
+    return stats;
+}
+#endif
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::hashFunction(const K &key)
+{
+    return hasher_(key) & (table_size_ - 1); //table size is a power of two, so masking the low bits replaces the modulo
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::findIndex(const K &key)
+{
+    return findIndex(key, hasher_(key));
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::findIndex(const K &key, uint64_t hash)
+{
+    size_t address = hash & (table_size_ - 1); //table size is a power of two, so masking the low bits replaces the modulo
+
+    //items are ordered by probe distance, so once an item closer to its home slot than the search is reached, the key cannot appear any later
+    for(uint32_t distance = 0; probe_distance_[address] != EMPTY_ && distance <= probe_distance_[address]; distance++)
+    {
+        //when an item with a matching key is found, return its index
+        if(key_equal_(hash_table_[address].getItem().getKey(), key))
+        {
+            return address;
+        }
+
+        address = (address + 1) & (table_size_ - 1); //increment the index, wrapping around to the start
+    }
+
+    //if no matching key was found, return the table size
+    return table_size_;
 }
 
-template<typename ItemType>
-double HashTable<ItemType>::loadFactor()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::placeItem(HashSlot<KeyType, ItemType> slot)
+{
+    size_t address = hashFunction(slot.getItem().getKey()); //hash the key to get its address
+    uint32_t distance = 0; //distance of the item being placed from its home slot
+
+    while(probe_distance_[address] != EMPTY_)
+    {
+        //take the slot from any item that is closer to its home slot ("richer") than the item being placed, then continue placing the displaced item
+        if(probe_distance_[address] < distance)
+        {
+            std::swap(slot, hash_table_[address]);
+            std::swap(distance, probe_distance_[address]);
+        }
+
+        address = (address + 1) & (table_size_ - 1); //increment the index, wrapping around to the start
+        distance++;
+    }
+
+    hash_table_[address] = slot;
+    probe_distance_[address] = distance;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+double HashTable<KeyType, ItemType, Hasher, KeyEqual>::loadFactor()
 {
     return (1.0 * item_count_) / table_size_;
 }
 
-template<typename ItemType>
-void HashTable<ItemType>::rehashTable()
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::tableSizeFor(size_t count)
+{
+    size_t size = MIN_TABLE_SIZE_;
+
+    //double the table size until the items fit without exceeding the maximum load factor
+    while(count > size * max_load_factor_)
+    {
+        size = 2 * size;
+    }
+
+    return size;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::rehashTable(size_t new_size)
 {
-    HashItem<ItemType> **temp = hash_table_; //create a temporary copy of the old table
+#ifdef HASH_TABLE_STATS
+    auto rehash_start = std::chrono::steady_clock::now();
+#endif
+
+    HashSlot<KeyType, ItemType> *temp = hash_table_; //create a temporary copy of the old table
+    uint32_t *temp_distance = probe_distance_; //create a temporary copy of the old probe distances
 
     size_t temp_size = table_size_; //create a temporary copy of the old table size
-    table_size_ = 2 * table_size_; //increase the table size
-    item_count_ = 0; //reset the item count
+    table_size_ = new_size;
+
+    hash_table_ = new HashSlot<KeyType, ItemType>[table_size_]; //create a new array of slots with the new size
+    probe_distance_ = new uint32_t[table_size_];
 
-    hash_table_ = new HashItem<ItemType> *[table_size_]; //create a new array of pointers with the increased size
+    //mark each index of the new array as empty
+    for(size_t i = 0; i < table_size_; i++)
+    {
+        probe_distance_[i] = EMPTY_;
+    }
 
-    //loop through the temporary copy and insert each item into the new table
-    for(int i = 0; i < temp_size; i++)
+    //loop through the temporary copy and place each existing item into the new table; slots are copied as they are, so inline items are moved with a plain copy and out-of-line items are not reallocated
+    for(size_t i = 0; i < temp_size; i++)
     {
-        if(temp[i] != nullptr)
+        if(temp_distance[i] != EMPTY_)
         {
-            insert(temp[i]->getKey(), temp[i]->getValue());
+            placeItem(temp[i]);
         }
     }
 
     //delete the old table and free memory
     delete[] temp;
+    delete[] temp_distance;
     temp = nullptr;
+    temp_distance = nullptr;
+
+#ifdef HASH_TABLE_STATS
+    rehash_count_++;
+    rehash_seconds_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - rehash_start).count();
+#endif
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+ItemType *HashTable<KeyType, ItemType, Hasher, KeyEqual>::findValue(const K &key, uint64_t hash)
+{
+    size_t index = findIndex(key, hash);
+
+    return (index != table_size_) ? hash_table_[index].getItem().getValuePointer() : nullptr;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::prefetchBucket(uint64_t hash)
+{
+    size_t address = hash & (table_size_ - 1);
+
+    prefetch(hash_table_ + address);
+    prefetch(probe_distance_ + address);
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::prefetch(const void *address)
+{
+#if defined(__GNUC__)
+    __builtin_prefetch(address);
+#else
+    (void)address; //no portable prefetch; the batch functions still work, just without the overlap
+#endif
 }
@@ -0,0 +1,27 @@
+/*
+Title: Hash Table Statistics
+Author: Edwin Khew
+Description: Hash table statistics struct implementation.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+
+inline void HashTableStats::display() const
+{
+    std::cout << "Item Count: " << item_count_ << std::endl;
+    std::cout << "Table Size: " << table_size_ << std::endl;
+    std::cout << "Load Factor: " << load_factor_ << std::endl;
+    std::cout << "Max Probe Length: " << max_probe_length_ << std::endl;
+    std::cout << "Max Chain Length: " << max_chain_length_ << std::endl;
+    std::cout << "Rehash Count: " << rehash_count_ << std::endl;
+    std::cout << "Rehash Time: " << rehash_seconds_ << "s" << std::endl;
+    std::cout << "Tombstone Ratio: " << tombstone_ratio_ << std::endl;
+    std::cout << "Bytes Per Entry: " << bytes_per_entry_ << std::endl;
+    std::cout << "Probe Length Histogram:" << std::endl;
+
+    for(size_t i = 0; i < probe_histogram_.size(); i++)
+    {
+        std::cout << "  " << i << ": " << probe_histogram_[i] << std::endl;
+    }
+}
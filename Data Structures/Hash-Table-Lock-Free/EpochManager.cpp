@@ -0,0 +1,174 @@
+/*
+Title: Epoch-Based Reclamation
+Author: Edwin Khew
+Description: Epoch manager class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <atomic>
+#include <vector>
+
+inline EpochManager::Guard::Guard()
+{
+    EpochManager::instance().enter();
+}
+
+inline EpochManager::Guard::~Guard()
+{
+    EpochManager::instance().exit();
+}
+
+inline EpochManager &EpochManager::instance()
+{
+    static EpochManager manager; //constructed on first use; thread-safe since C++11
+
+    return manager;
+}
+
+inline EpochManager::EpochManager():global_epoch_(0), records_(nullptr)
+{
+}
+
+inline EpochManager::~EpochManager()
+{
+    ThreadRecord *record = records_.load();
+
+    //no thread can be pinned anymore, so free everything that is left and delete every record
+    while(record != nullptr)
+    {
+        ThreadRecord *next = record->next_;
+
+        for(auto &i : record->retired_)
+        {
+            i.deleter_(i.pointer_);
+        }
+
+        delete record;
+        record = next;
+    }
+}
+
+inline void EpochManager::enter()
+{
+    ThreadRecord *record = localRecord();
+
+    if(record->nesting_++ == 0) //outermost pin
+    {
+        record->state_.store((global_epoch_.load() << 1) | 1);
+        std::atomic_thread_fence(std::memory_order_seq_cst); //make the pin visible before reading any shared node
+    }
+}
+
+inline void EpochManager::exit()
+{
+    ThreadRecord *record = localRecord();
+
+    if(--record->nesting_ == 0) //outermost unpin
+    {
+        record->state_.store(record->state_.load(std::memory_order_relaxed) & ~1ULL, std::memory_order_release);
+    }
+}
+
+inline void EpochManager::retire(void *pointer, void (*deleter)(void *))
+{
+    ThreadRecord *record = localRecord();
+
+    record->retired_.push_back({pointer, deleter, global_epoch_.load()});
+
+    if(record->retired_.size() >= COLLECT_THRESHOLD_)
+    {
+        tryAdvance();
+        collect(record);
+    }
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+inline EpochManager::ThreadHandle::~ThreadHandle()
+{
+    if(record_ != nullptr)
+    {
+        EpochManager &manager = EpochManager::instance();
+
+        manager.tryAdvance();
+        manager.collect(record_);
+
+        //whatever is left stays in the record, and is freed by the next thread to claim it
+        record_->state_.store(0);
+        record_->in_use_.store(false, std::memory_order_release);
+    }
+}
+
+inline EpochManager::ThreadRecord *EpochManager::localRecord()
+{
+    thread_local ThreadHandle handle; //destroyed when the thread exits
+
+    if(handle.record_ == nullptr)
+    {
+        handle.record_ = acquireRecord();
+    }
+
+    return handle.record_;
+}
+
+inline EpochManager::ThreadRecord *EpochManager::acquireRecord()
+{
+    //reuse the record of a thread that has exited
+    for(ThreadRecord *record = records_.load(std::memory_order_acquire); record != nullptr; record = record->next_)
+    {
+        bool expected = false;
+
+        if(!record->in_use_.load(std::memory_order_relaxed) && record->in_use_.compare_exchange_strong(expected, true, std::memory_order_acquire))
+        {
+            return record;
+        }
+    }
+
+    //otherwise push a new record to the front of the list
+    ThreadRecord *record = new ThreadRecord();
+    record->state_.store(0, std::memory_order_relaxed);
+    record->in_use_.store(true, std::memory_order_relaxed);
+    record->nesting_ = 0;
+    record->next_ = records_.load(std::memory_order_relaxed);
+
+    while(!records_.compare_exchange_weak(record->next_, record, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+
+    return record;
+}
+
+inline bool EpochManager::tryAdvance()
+{
+    uint64_t epoch = global_epoch_.load();
+
+    //the epoch can only advance once every pinned thread has observed it
+    for(ThreadRecord *record = records_.load(std::memory_order_acquire); record != nullptr; record = record->next_)
+    {
+        uint64_t state = record->state_.load();
+
+        if((state & 1) != 0 && (state >> 1) != epoch)
+        {
+            return false;
+        }
+    }
+
+    return global_epoch_.compare_exchange_strong(epoch, epoch + 1);
+}
+
+inline void EpochManager::collect(ThreadRecord *record)
+{
+    uint64_t epoch = global_epoch_.load();
+    size_t count = 0; //number of retired pointers that can be freed; they form a prefix since the list is in epoch order
+
+    //a thread pinned during the epoch a pointer was retired in may still be reading it until the global epoch is two ahead
+    while(count < record->retired_.size() && record->retired_[count].epoch_ + 2 <= epoch)
+    {
+        record->retired_[count].deleter_(record->retired_[count].pointer_);
+        count++;
+    }
+
+    record->retired_.erase(record->retired_.begin(), record->retired_.begin() + count);
+}
@@ -0,0 +1,140 @@
+/*
+Title: Epoch-Based Reclamation
+Author: Edwin Khew
+Description: Epoch manager class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef EPOCH_MANAGER_H_
+#define EPOCH_MANAGER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/*
+    frees memory that lock-free data structures have unlinked, once no thread can still be reading it; a thread "pins" itself while it reads shared nodes, and a retired node is only freed after every pinned thread has moved two epochs past the one it was retired in
+*/
+class EpochManager
+{
+public:
+    /*
+        RAII guard; pins the calling thread for as long as the guard exists
+    */
+    class Guard
+    {
+    public:
+        /*
+            default constructor; pins the calling thread
+        */
+        Guard();
+
+        /*
+            destructor; unpins the calling thread
+        */
+        ~Guard();
+
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+    };
+
+    /*
+        returns the process-wide epoch manager shared by every lock-free table
+        @return a reference to the epoch manager
+    */
+    static EpochManager &instance();
+
+    /*
+        destructor; frees every pointer that is still waiting to be reclaimed
+    */
+    ~EpochManager();
+
+    /*
+        pins the calling thread to the current epoch; pins can be nested, and only the outermost one has any effect
+    */
+    void enter();
+
+    /*
+        unpins the calling thread
+    */
+    void exit();
+
+    /*
+        schedules a pointer to be freed once no pinned thread can still be reading it
+        @param pointer, pointer to the unlinked object
+        @param deleter, function that frees the object
+    */
+    void retire(void *pointer, void (*deleter)(void *));
+private:
+    static const size_t COLLECT_THRESHOLD_ = 64; //number of retired pointers a thread collects before trying to free them
+
+    /*
+        a retired pointer waiting to be freed
+    */
+    struct RetiredPointer
+    {
+        void *pointer_; //the object to free
+        void (*deleter_)(void *); //function that frees the object
+        uint64_t epoch_; //global epoch when the object was retired
+    };
+
+    /*
+        per-thread state; aligned to a cache line so that threads pinning themselves never write to the same line
+    */
+    struct alignas(64) ThreadRecord
+    {
+        std::atomic<uint64_t> state_; //the epoch the thread is pinned to shifted left by one; the lowest bit is set while the thread is pinned
+        std::atomic<bool> in_use_; //whether a live thread owns this record; records of exited threads are reused
+        size_t nesting_; //depth of nested pins; only used by the owning thread
+        std::vector<RetiredPointer> retired_; //pointers retired by the owning thread; kept in epoch order
+        ThreadRecord *next_; //next record in the list; never changes once the record is published
+    };
+
+    /*
+        releases the calling thread's record when the thread exits
+    */
+    struct ThreadHandle
+    {
+        ThreadRecord *record_ = nullptr; //record owned by the thread; 'nullptr' until the thread first uses the manager
+
+        /*
+            destructor; frees what it can of the thread's retired pointers and hands the record back for reuse
+        */
+        ~ThreadHandle();
+    };
+
+    std::atomic<uint64_t> global_epoch_; //current global epoch
+    std::atomic<ThreadRecord *> records_; //head of the list of thread records; records are only ever added
+
+    /*
+        default constructor; private, since the manager is only accessed through 'instance'
+    */
+    EpochManager();
+
+    /*
+        returns the calling thread's record, claiming one on first use
+        @return a pointer to the thread's record
+    */
+    ThreadRecord *localRecord();
+
+    /*
+        claims an unused record, or publishes a new one if every record is in use
+        @return a pointer to the claimed record
+    */
+    ThreadRecord *acquireRecord();
+
+    /*
+        advances the global epoch if every pinned thread has reached it
+        @return true if the epoch was advanced, false otherwise
+    */
+    bool tryAdvance();
+
+    /*
+        frees every retired pointer of a record that no pinned thread can still be reading
+        @param record, the record whose retired pointers to free
+    */
+    void collect(ThreadRecord *record);
+};
+
+#include "EpochManager.cpp"
+#endif
@@ -0,0 +1,423 @@
+/*
+Title: Hash Table (lock-free; split-ordered list)
+Author: Edwin Khew
+Description: Lock-free hash table class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::Node::Node(uint64_t so_key):so_key_(so_key), key_(), value_(), next_(nullptr)
+{
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::Node::Node(uint64_t so_key, const KeyType &key, const ItemType &value):so_key_(so_key), key_(key), value_(value), next_(nullptr)
+{
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::LockFreeHashTable():item_count_(0), bucket_count_(INITIAL_BUCKETS_)
+{
+    for(size_t i = 0; i < MAX_SEGMENTS_; i++)
+    {
+        segments_[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    bucketSlot(0).store(new Node(dummyKey(0)), std::memory_order_release); //bucket 0 is the head of the list; every other bucket is created from it
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::~LockFreeHashTable()
+{
+    Node *curr = bucketSlot(0).load();
+
+    //every node still in the list (including removed nodes that were never unlinked) belongs to the table; unlinked nodes belong to the epoch manager
+    while(curr != nullptr)
+    {
+        Node *next = unmark(curr->next_.load());
+        delete curr;
+        curr = next;
+    }
+
+    for(size_t i = 0; i < MAX_SEGMENTS_; i++)
+    {
+        delete[] segments_[i].load();
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+bool LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::insert(const KeyType &key, ItemType value)
+{
+    EpochManager::Guard guard; //keeps every node this thread reads alive until the operation ends
+
+    uint64_t hash = hasher_(key);
+    Node *head = getBucket(hash & (bucket_count_.load(std::memory_order_acquire) - 1));
+    Node *new_item = new Node(regularKey(hash), key, value);
+
+    std::atomic<Node *> *prev;
+    Node *curr;
+
+    while(true)
+    {
+        if(find(head, new_item->so_key_, key, prev, curr)) //an item with the same key already exists
+        {
+            delete new_item; //never published, so it can be freed right away
+            return false;
+        }
+
+        new_item->next_.store(curr, std::memory_order_relaxed);
+
+        //link the new item in; fails if the list changed around 'prev' in the meantime, in which case search again
+        if(prev->compare_exchange_weak(curr, new_item, std::memory_order_release, std::memory_order_relaxed))
+        {
+            break;
+        }
+    }
+
+    size_t count = item_count_.fetch_add(1, std::memory_order_relaxed) + 1;
+    size_t buckets = bucket_count_.load(std::memory_order_relaxed);
+
+    //if the load factor exceeds the specified limit after insertion of the new item, double the bucket count; the new buckets are only created once something uses them
+    if(count > buckets * MAX_LOAD_ && buckets < (INITIAL_BUCKETS_ << (MAX_SEGMENTS_ - 1)))
+    {
+        bucket_count_.compare_exchange_strong(buckets, 2 * buckets, std::memory_order_release, std::memory_order_relaxed);
+    }
+
+    return true;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+void LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::remove(const K &key)
+{
+    EpochManager::Guard guard;
+
+    uint64_t hash = hasher_(key);
+    uint64_t so_key = regularKey(hash);
+    Node *head = getBucket(hash & (bucket_count_.load(std::memory_order_acquire) - 1));
+
+    std::atomic<Node *> *prev;
+    Node *curr;
+
+    while(true)
+    {
+        if(!find(head, so_key, key, prev, curr)) //item does not exist
+        {
+            return;
+        }
+
+        Node *next = curr->next_.load(std::memory_order_acquire);
+
+        //mark the item's own link first; this is the point where the item is removed, and it stops any other thread from linking a node after it
+        if(isMarked(next) || !curr->next_.compare_exchange_strong(next, mark(next), std::memory_order_acq_rel))
+        {
+            continue; //another thread changed the item first; search again
+        }
+
+        item_count_.fetch_sub(1, std::memory_order_relaxed);
+
+        //then try to unlink it; if that fails, searching again unlinks it instead
+        if(prev->compare_exchange_strong(curr, next, std::memory_order_acq_rel))
+        {
+            EpochManager::instance().retire(curr, deleteNode);
+        }
+        else
+        {
+            find(head, so_key, key, prev, curr);
+        }
+
+        return;
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::clear()
+{
+    EpochManager::Guard guard;
+
+    Node *curr = unmark(bucketSlot(0).load(std::memory_order_acquire)->next_.load(std::memory_order_acquire));
+
+    //remove every item in the list one at a time; the guard keeps removed nodes readable, so the walk can continue past them
+    while(curr != nullptr)
+    {
+        Node *next = curr->next_.load(std::memory_order_acquire);
+
+        if((curr->so_key_ & 1) != 0 && !isMarked(next)) //item that has not been removed yet
+        {
+            remove(curr->key_);
+        }
+
+        curr = unmark(curr->next_.load(std::memory_order_acquire));
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+bool LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::isEmpty()
+{
+    return itemCount() == 0;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+size_t LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::itemCount()
+{
+    return item_count_.load(std::memory_order_relaxed);
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+ItemType LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::getValue(const K &key)
+{
+    EpochManager::Guard guard;
+
+    uint64_t hash = hasher_(key);
+    Node *head = getBucket(hash & (bucket_count_.load(std::memory_order_acquire) - 1));
+
+    std::atomic<Node *> *prev;
+    Node *curr;
+
+    if(find(head, regularKey(hash), key, prev, curr)) //when an item with a matching key is found, return its value
+    {
+        return curr->value_;
+    }
+
+    //if no matching key was found, throw an exception
+    throw(std::out_of_range("Position out of range!"));
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+bool LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::contains(const K &key)
+{
+    EpochManager::Guard guard;
+
+    uint64_t hash = hasher_(key);
+    Node *head = getBucket(hash & (bucket_count_.load(std::memory_order_acquire) - 1));
+
+    std::atomic<Node *> *prev;
+    Node *curr;
+
+    return find(head, regularKey(hash), key, prev, curr);
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::display()
+{
+    EpochManager::Guard guard;
+
+    for(Node *curr = bucketSlot(0).load(std::memory_order_acquire); curr != nullptr; curr = unmark(curr->next_.load(std::memory_order_acquire)))
+    {
+        if((curr->so_key_ & 1) == 0) //dummy node; starts the line of its bucket
+        {
+            if(curr->so_key_ != 0)
+            {
+                std::cout << std::endl;
+            }
+
+            std::cout << reverseBits(curr->so_key_);
+        }
+        else if(!isMarked(curr->next_.load(std::memory_order_acquire))) //item that has not been removed
+        {
+            std::cout << " --> " << curr->value_;
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+bool LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::find(Node *head, uint64_t so_key, const K &key, std::atomic<Node *> *&prev, Node *&curr)
+{
+retry:
+    prev = &head->next_; //a dummy node is never removed, so its link is never marked
+    curr = prev->load(std::memory_order_acquire);
+
+    while(curr != nullptr)
+    {
+        Node *next = curr->next_.load(std::memory_order_acquire);
+
+        //'curr' has been removed; help unlink it before moving on, and start over if the list changed around it
+        if(isMarked(next))
+        {
+            Node *expected = curr;
+
+            if(!prev->compare_exchange_strong(expected, unmark(next), std::memory_order_acq_rel))
+            {
+                goto retry;
+            }
+
+            EpochManager::instance().retire(curr, deleteNode); //only the thread whose unlink succeeds retires the node
+            curr = unmark(next);
+            continue;
+        }
+
+        if(curr->so_key_ > so_key) //the list is sorted by split-order key, so the node cannot appear any later
+        {
+            return false;
+        }
+
+        //items with the same split-order key have the same hash, so their keys still have to be compared
+        if(curr->so_key_ == so_key && ((so_key & 1) == 0 || key_equal_(curr->key_, key)))
+        {
+            return true;
+        }
+
+        prev = &curr->next_;
+        curr = next;
+    }
+
+    return false;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+typename LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::Node *LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::getBucket(size_t bucket)
+{
+    std::atomic<Node *> &slot = bucketSlot(bucket);
+    Node *head = slot.load(std::memory_order_acquire);
+
+    if(head != nullptr) //bucket already exists
+    {
+        return head;
+    }
+
+    //a bucket splits off from its parent, the bucket index without its highest bit; its dummy node goes into the parent's part of the list
+    Node *parent = getBucket(bucket & ~(1ULL << highestBit(bucket)));
+    Node *dummy = new Node(dummyKey(bucket));
+
+    std::atomic<Node *> *prev;
+    Node *curr;
+
+    while(true)
+    {
+        if(find(parent, dummy->so_key_, dummy->key_, prev, curr)) //another thread created the bucket first
+        {
+            delete dummy;
+            dummy = curr;
+            break;
+        }
+
+        dummy->next_.store(curr, std::memory_order_relaxed);
+
+        if(prev->compare_exchange_weak(curr, dummy, std::memory_order_release, std::memory_order_relaxed))
+        {
+            break;
+        }
+    }
+
+    slot.store(dummy, std::memory_order_release); //every thread that gets here stores the same node
+
+    return dummy;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+std::atomic<typename LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::Node *> &LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::bucketSlot(size_t bucket)
+{
+    size_t segment = 0; //the first segment holds buckets [0, INITIAL_BUCKETS_), and segment i holds buckets [INITIAL_BUCKETS_ * 2^(i-1), INITIAL_BUCKETS_ * 2^i)
+    size_t offset = bucket;
+
+    if(bucket >= INITIAL_BUCKETS_)
+    {
+        segment = highestBit(bucket / INITIAL_BUCKETS_) + 1;
+        offset = bucket - (INITIAL_BUCKETS_ << (segment - 1));
+    }
+
+    std::atomic<Node *> *buckets = segments_[segment].load(std::memory_order_acquire);
+
+    //allocate the segment on first use; if another thread publishes one first, use that one instead
+    if(buckets == nullptr)
+    {
+        size_t segment_size = (segment == 0) ? INITIAL_BUCKETS_ : (INITIAL_BUCKETS_ << (segment - 1));
+        std::atomic<Node *> *new_buckets = new std::atomic<Node *>[segment_size];
+
+        for(size_t i = 0; i < segment_size; i++)
+        {
+            new_buckets[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        if(segments_[segment].compare_exchange_strong(buckets, new_buckets, std::memory_order_acq_rel))
+        {
+            buckets = new_buckets;
+        }
+        else
+        {
+            delete[] new_buckets;
+        }
+    }
+
+    return buckets[offset];
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+uint64_t LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::regularKey(uint64_t hash)
+{
+    return reverseBits(hash | (1ULL << 63)); //the bucket index only uses the low bits of the hash, so the top bit is free to become the lowest bit
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+uint64_t LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::dummyKey(size_t bucket)
+{
+    return reverseBits(bucket);
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+uint64_t LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::reverseBits(uint64_t value)
+{
+    //swap adjacent bits, then pairs, then nibbles, bytes, 16-bit halves and 32-bit halves
+    value = ((value >> 1) & 0x5555555555555555ULL) | ((value & 0x5555555555555555ULL) << 1);
+    value = ((value >> 2) & 0x3333333333333333ULL) | ((value & 0x3333333333333333ULL) << 2);
+    value = ((value >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((value & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    value = ((value >> 8) & 0x00FF00FF00FF00FFULL) | ((value & 0x00FF00FF00FF00FFULL) << 8);
+    value = ((value >> 16) & 0x0000FFFF0000FFFFULL) | ((value & 0x0000FFFF0000FFFFULL) << 16);
+
+    return (value >> 32) | (value << 32);
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+int LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::highestBit(uint64_t value)
+{
+#if defined(__GNUC__)
+    return 63 - __builtin_clzll(value);
+#else
+    int position = 0;
+
+    while(value > 1)
+    {
+        value >>= 1;
+        position++;
+    }
+
+    return position;
+#endif
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+bool LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::isMarked(Node *node)
+{
+    return (reinterpret_cast<uintptr_t>(node) & 1) != 0;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+typename LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::Node *LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::mark(Node *node)
+{
+    return reinterpret_cast<Node *>(reinterpret_cast<uintptr_t>(node) | 1);
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+typename LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::Node *LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::unmark(Node *node)
+{
+    return reinterpret_cast<Node *>(reinterpret_cast<uintptr_t>(node) & ~static_cast<uintptr_t>(1));
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void LockFreeHashTable<KeyType, ItemType, Hasher, KeyEqual>::deleteNode(void *node)
+{
+    delete static_cast<Node *>(node);
+}
@@ -0,0 +1,192 @@
+/*
+Title: Hash Table (lock-free; split-ordered list)
+Author: Edwin Khew
+Description: Lock-free hash table class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef LOCK_FREE_HASH_TABLE_H_
+#define LOCK_FREE_HASH_TABLE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional> //for std::equal_to
+
+/*
+    a hash table that any number of threads can use at once without locks; every item lives in one sorted lock-free linked list, and each bucket is a shortcut into that list, so growing the table only adds shortcuts and never moves an item
+*/
+template <class KeyType, class ItemType, class Hasher = WyHash, class KeyEqual = std::equal_to<>>
+class LockFreeHashTable
+{
+public:
+    /*
+        default constructor
+    */
+    LockFreeHashTable();
+
+    /*
+        destructor; no other thread may be using the table
+    */
+    ~LockFreeHashTable();
+
+    /*
+        inserts a new item into the hash table if no item with the same key exists; the value of an existing item is never replaced, so readers always see a value as it was inserted
+        @param key, key of the item to insert
+        @param value, value of the item to insert
+        @return true if the item was inserted, false if an item with the same key already exists
+    */
+    bool insert(const KeyType &key, const ItemType value);
+
+    /*
+        removes an item with the specified key from the hash table
+        @param key, key of the item to remove; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+    */
+    template <class K>
+    void remove(const K &key);
+
+    /*
+        removes every item from the hash table; items inserted by other threads while clearing may be kept
+    */
+    void clear();
+
+    /*
+        checks if the table is currently empty
+        @return true if the table is empty, false otherwise
+    */
+    bool isEmpty();
+
+    /*
+        returns the number of items currently in the table
+        @return an integer representing the number of items currently in the table
+    */
+    size_t itemCount();
+
+    /*
+        returns the item with the specified key; never blocks, even while the table is growing
+        @param key, key of the item to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+        @return the item with the matching key
+    */
+    template <class K>
+    ItemType getValue(const K &key);
+
+    /*
+        checks the table to see if a an item with the specified key exists; never blocks, even while the table is growing
+        @param key, key of the item to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+        @return true if the item exists in the table, and false otherwise
+    */
+    template <class K>
+    bool contains(const K &key);
+
+    /*
+        prints every item currently in the table; each line starts with a bucket, in the order the buckets appear in the list
+    */
+    void display();
+private:
+    /*
+        a node of the list; either a bucket's dummy node (even split-order key) or an item (odd split-order key)
+    */
+    struct Node
+    {
+        uint64_t so_key_; //split-order key; the bit-reversed hash, which keeps every bucket's items together in the list
+        KeyType key_; //key of the item; unused by dummy nodes
+        ItemType value_; //value of the item; unused by dummy nodes
+        std::atomic<Node *> next_; //pointer to the next node; the lowest bit is set once this node has been removed
+
+        Node(uint64_t so_key);
+        Node(uint64_t so_key, const KeyType &key, const ItemType &value);
+    };
+
+    static const size_t INITIAL_BUCKETS_ = 16; //number of buckets in the first segment
+    static const size_t MAX_SEGMENTS_ = 48; //number of bucket segments; each segment after the first doubles the bucket count
+    static const size_t MAX_LOAD_ = 2; //average number of items per bucket before the bucket count doubles
+
+    alignas(64) std::atomic<size_t> item_count_; //current number of items in the table; on its own cache line since every insert and remove updates it
+    alignas(64) std::atomic<size_t> bucket_count_; //current number of buckets; always a power of two
+    std::atomic<std::atomic<Node *> *> segments_[MAX_SEGMENTS_]; //arrays of bucket pointers; allocated as the table grows and never moved, so readers never wait on a resize
+    Hasher hasher_; //hash function object; mixes a key into 64 well-distributed bits
+    KeyEqual key_equal_; //key comparison function object; checks if two keys are equal
+
+    /*
+        searches the list, starting from a bucket's dummy node, for a node; removed nodes passed along the way are unlinked
+        @param head, dummy node of the bucket to start from
+        @param so_key, split-order key of the node to search for
+        @param key, key of the item to search for; ignored when searching for a dummy node
+        @param prev, set to the link that points to 'curr'
+        @param curr, set to the matching node, or to the first node after where it would be
+        @return true if a matching node was found, false otherwise
+    */
+    template <class K>
+    bool find(Node *head, uint64_t so_key, const K &key, std::atomic<Node *> *&prev, Node *&curr);
+
+    /*
+        returns the dummy node of a bucket, creating it (and any missing parent buckets) if needed
+        @param bucket, index of the bucket
+        @return a pointer to the bucket's dummy node
+    */
+    Node *getBucket(size_t bucket);
+
+    /*
+        returns the slot holding a bucket's dummy node pointer, allocating its segment if needed
+        @param bucket, index of the bucket
+        @return a reference to the slot
+    */
+    std::atomic<Node *> &bucketSlot(size_t bucket);
+
+    /*
+        split-order key of an item; the lowest bit is always set, so items sort after their bucket's dummy node
+        @param hash, full hash of the item's key
+        @return the split-order key
+    */
+    static uint64_t regularKey(uint64_t hash);
+
+    /*
+        split-order key of a bucket's dummy node; the lowest bit is always clear
+        @param bucket, index of the bucket
+        @return the split-order key
+    */
+    static uint64_t dummyKey(size_t bucket);
+
+    /*
+        reverses the order of the bits of a value
+        @param value, value to reverse
+        @return the bit-reversed value
+    */
+    static uint64_t reverseBits(uint64_t value);
+
+    /*
+        returns the index of the highest set bit of a non-zero value
+        @param value, the value to search
+        @return an integer representing the position of the highest set bit
+    */
+    static int highestBit(uint64_t value);
+
+    /*
+        checks if a link is marked, which means the node holding it has been removed
+        @param node, the link to check
+        @return true if the link is marked, false otherwise
+    */
+    static bool isMarked(Node *node);
+
+    /*
+        returns a link with the mark set
+        @param node, the link to mark
+        @return the marked link
+    */
+    static Node *mark(Node *node);
+
+    /*
+        returns a link with the mark cleared
+        @param node, the link to unmark
+        @return the unmarked link
+    */
+    static Node *unmark(Node *node);
+
+    /*
+        frees a node; passed to the epoch manager once the node has been unlinked
+        @param node, pointer to the node to free
+    */
+    static void deleteNode(void *node);
+};
+
+#include "LockFreeHashTable.cpp"
+#endif
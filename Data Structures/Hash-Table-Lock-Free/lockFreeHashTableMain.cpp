@@ -0,0 +1,117 @@
+/*
+Title: Hash Table (lock-free; split-ordered list)
+Author: Edwin Khew
+Description: Lock-free hash table test file.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "Hasher.hpp"
+#include "EpochManager.hpp"
+#include "LockFreeHashTable.hpp"
+
+using namespace std;
+
+int main()
+{
+    LockFreeHashTable<int, string> myTable;
+    //LockFreeHashTable<int, string, FibonacciHash> myTable; //hasher test; other hashers: WyHash (default), Crc32Hash
+
+    myTable.insert(279, "Penny");
+    myTable.insert(298, "Shelly");
+    myTable.insert(264, "Colt");
+    myTable.insert(302, "Spike");
+    myTable.insert(301, "Brock");
+    myTable.insert(287, "Edgar");
+    myTable.insert(289, "Sandy");
+    myTable.insert(304, "Leon");
+    myTable.insert(280, "Bea");
+    myTable.insert(294, "Jessie");
+    myTable.insert(295, "Tara");
+    myTable.insert(334, "Rosa");
+    myTable.insert(292, "Crow");
+    myTable.insert(300, "Lou");
+
+    cout << "Insert (existing key): " << myTable.insert(279, "Penny (Updated)") << endl; //existing key; the value is kept
+
+    myTable.remove(301);
+
+    cout << "Is Empty: " << myTable.isEmpty() << endl;
+    cout << "Item Count: " << myTable.itemCount() << endl;
+    cout << "Contains: " << myTable.contains(301) << endl;
+
+    try
+    {
+        cout << "Get Value: " << myTable.getValue(279) << endl;
+    }
+    catch(const std::out_of_range& problem)
+    {
+        cout << "Item not found!" << endl;
+    }
+
+    cout << "Display: " << endl << endl;
+    myTable.display();
+
+    myTable.clear();
+
+    cout << endl << "Is Empty (After clear): " << myTable.isEmpty() << endl;
+    cout << "Item Count (After clear): " << myTable.itemCount() << endl;
+
+    /*
+        thread test; writers insert their own ranges of keys while readers look them up, and the table grows several times along the way
+    */
+    const int THREAD_COUNT = 4;
+    const int ITEMS_PER_THREAD = 10000;
+
+    vector<thread> threads;
+    int found[THREAD_COUNT] = {};
+
+    for(int t = 0; t < THREAD_COUNT; t++)
+    {
+        threads.push_back(thread([&myTable, t, ITEMS_PER_THREAD]()
+        {
+            for(int i = t * ITEMS_PER_THREAD; i < (t + 1) * ITEMS_PER_THREAD; i++)
+            {
+                myTable.insert(i, to_string(i));
+            }
+        }));
+
+        threads.push_back(thread([&myTable, &found, t, THREAD_COUNT, ITEMS_PER_THREAD]()
+        {
+            for(int i = 0; i < THREAD_COUNT * ITEMS_PER_THREAD; i++)
+            {
+                found[t] += myTable.contains(i);
+            }
+        }));
+    }
+
+    for(auto &i : threads)
+    {
+        i.join();
+    }
+
+    cout << endl << "Item Count (After threads): " << myTable.itemCount() << endl;
+
+    for(int t = 0; t < THREAD_COUNT; t++)
+    {
+        cout << "Found by reader " << t << ": " << found[t] << endl; //depends on how far the writers got
+    }
+
+    /*
+        string key test; looks up std::string keys with std::string_view keys, which does not copy the key into a std::string
+    */
+    LockFreeHashTable<string, int> myStringTable;
+
+    myStringTable.insert("Penny", 279);
+    myStringTable.insert("Shelly", 298);
+    myStringTable.insert("Colt", 264);
+
+    string_view name = "Shelly";
+
+    cout << endl << "Contains (string_view): " << myStringTable.contains(name) << endl;
+    cout << "Get Value (string_view): " << myStringTable.getValue(name) << endl;
+}
@@ -0,0 +1,57 @@
+/*
+Title: Hash Slot (inline or out-of-line hash item storage)
+Author: Edwin Khew
+Description: Hash slot class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <new> //for placement new and std::launder
+
+template<typename KeyType, typename ItemType, bool Inline>
+void HashSlot<KeyType, ItemType, Inline>::construct(const KeyType &key, const ItemType &value)
+{
+    item_ = new HashItem<KeyType, ItemType>(key, value);
+}
+
+template<typename KeyType, typename ItemType, bool Inline>
+void HashSlot<KeyType, ItemType, Inline>::destroy()
+{
+    delete item_;
+    item_ = nullptr;
+}
+
+template<typename KeyType, typename ItemType, bool Inline>
+HashItem<KeyType, ItemType> &HashSlot<KeyType, ItemType, Inline>::getItem()
+{
+    return *item_;
+}
+
+template<typename KeyType, typename ItemType, bool Inline>
+bool HashSlot<KeyType, ItemType, Inline>::isInline()
+{
+    return false;
+}
+
+template<typename KeyType, typename ItemType>
+void HashSlot<KeyType, ItemType, true>::construct(const KeyType &key, const ItemType &value)
+{
+    new (storage_) HashItem<KeyType, ItemType>(key, value);
+}
+
+template<typename KeyType, typename ItemType>
+void HashSlot<KeyType, ItemType, true>::destroy()
+{
+    getItem().~HashItem(); //trivially copyable items have trivial destructors, so this compiles to nothing
+}
+
+template<typename KeyType, typename ItemType>
+HashItem<KeyType, ItemType> &HashSlot<KeyType, ItemType, true>::getItem()
+{
+    return *std::launder(reinterpret_cast<HashItem<KeyType, ItemType> *>(storage_));
+}
+
+template<typename KeyType, typename ItemType>
+bool HashSlot<KeyType, ItemType, true>::isInline()
+{
+    return true;
+}
@@ -0,0 +1,86 @@
+/*
+Title: Hash Slot (inline or out-of-line hash item storage)
+Author: Edwin Khew
+Description: Hash slot class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef HASH_SLOT_H_
+#define HASH_SLOT_H_
+
+#include <cstddef>
+#include <type_traits> //for std::is_trivially_copyable
+
+const size_t MAX_INLINE_ITEM_SIZE = 32; //largest item stored directly in a slot; every empty slot costs this much too, and items are copied whenever they move between slots
+
+/*
+    one slot of an open addressing table; holds a hash item out-of-line, through a pointer to an item allocated with 'new'. Used for items that are large or not trivially copyable (such as ones with std::string keys or values)
+    a slot does not know if it is in use; the table tracks that, and only calls 'getItem' and 'destroy' on slots holding an item. In both forms, a slot is trivially copyable, so the table moves items between slots with plain assignment
+*/
+template <class KeyType, class ItemType, bool Inline = std::is_trivially_copyable<HashItem<KeyType, ItemType>>::value && sizeof(HashItem<KeyType, ItemType>) <= MAX_INLINE_ITEM_SIZE>
+class HashSlot
+{
+public:
+    /*
+        creates an item in the slot
+        @param key, key of the item
+        @param value, value stored in the item
+    */
+    void construct(const KeyType &key, const ItemType &value);
+
+    /*
+        destroys the item in the slot
+    */
+    void destroy();
+
+    /*
+        returns the item in the slot
+        @return a reference to the item
+    */
+    HashItem<KeyType, ItemType> &getItem();
+
+    /*
+        checks if items are stored directly in their slots
+        @return true if they are, and false if slots point to their items
+    */
+    static bool isInline();
+private:
+    HashItem<KeyType, ItemType> *item_; //pointer to the item; only valid while the slot holds an item
+};
+
+/*
+    one slot of an open addressing table; holds a small, trivially copyable hash item inline, so that inserting it needs no allocation and reading it needs no pointer chase
+*/
+template <class KeyType, class ItemType>
+class HashSlot<KeyType, ItemType, true>
+{
+public:
+    /*
+        creates an item in the slot
+        @param key, key of the item
+        @param value, value stored in the item
+    */
+    void construct(const KeyType &key, const ItemType &value);
+
+    /*
+        destroys the item in the slot
+    */
+    void destroy();
+
+    /*
+        returns the item in the slot
+        @return a reference to the item
+    */
+    HashItem<KeyType, ItemType> &getItem();
+
+    /*
+        checks if items are stored directly in their slots
+        @return true if they are, and false if slots point to their items
+    */
+    static bool isInline();
+private:
+    alignas(HashItem<KeyType, ItemType>) unsigned char storage_[sizeof(HashItem<KeyType, ItemType>)]; //raw memory for the item; only holds a valid item while the slot is in use
+};
+
+#include "HashSlot.cpp"
+#endif
@@ -8,9 +8,12 @@ Date Created: 7/1/2021
 #ifndef HASH_TABLE_H_
 #define HASH_TABLE_H_
 
+#include <cstdint>
 #include <list>
+#include <functional> //for std::equal_to
+#include <utility> //for std::pair
 
-template <class ItemType>
+template <class KeyType, class ItemType, class Hasher = WyHash, class KeyEqual = std::equal_to<>>
 class HashTable
 {
 public:
@@ -19,24 +22,68 @@ public:
     */
     HashTable();
 
+    /*
+        destructor
+    */
+    ~HashTable();
+
+    HashTable(const HashTable &) = delete;
+    HashTable &operator=(const HashTable &) = delete;
+
     /*
         inserts a new item into the hash table
         @param key, key of the item to insert
         @param value, value of the item to insert
     */
-    void insert(int key, const ItemType value);
+    void insert(const KeyType &key, const ItemType value);
 
     /*
-        removes an item with the specified key from the hash table
-        @param key, key of the item to remove
+        removes an item with the specified key from the hash table; its slot is marked as deleted (a tombstone) rather than emptied, so that lookups for keys that probed past it keep going
+        @param key, key of the item to remove; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
     */
-    void remove(int key);
+    template <class K>
+    void remove(const K &key);
 
     /*
         removes every item from the hash table
     */
     void clear();
 
+    /*
+        presizes the table to hold the specified number of items without exceeding the maximum load factor, so that inserting them does not rehash; never shrinks the table
+        @param count, number of items the table should be able to hold
+    */
+    void reserve(size_t count);
+
+    /*
+        shrinks the table to the smallest size that holds its current items without exceeding the maximum load factor, freeing the memory left over from removed items
+    */
+    void shrinkToFit();
+
+    /*
+        returns the maximum load factor; the table grows once an insert takes the load factor above it
+        @return a decimal number representing the maximum load factor
+    */
+    double maxLoadFactor();
+
+    /*
+        sets the maximum load factor; if the table is already fuller than this, it is grown right away
+        @param load_factor, the new maximum load factor; must be greater than 0 and below 1, and more than twice the minimum load factor
+    */
+    void setMaxLoadFactor(double load_factor);
+
+    /*
+        returns the minimum load factor; the table is halved once a remove takes the load factor below it
+        @return a decimal number representing the minimum load factor
+    */
+    double minLoadFactor();
+
+    /*
+        sets the minimum load factor; 0 stops the table from ever shrinking on its own
+        @param load_factor, the new minimum load factor; must be at least 0, and less than half the maximum load factor so that a halved table is not grown again by the next insert
+    */
+    void setMinLoadFactor(double load_factor);
+
     /*
         checks if the table is currently empty
         @return true if the table is empty, false otherwise
@@ -51,33 +98,76 @@ public:
 
     /*
         returns the item with the specified key
-        @param key, key of the item to search for
+        @param key, key of the item to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
         @return the item with the matching key
     */
-    ItemType getValue(int key);
+    template <class K>
+    ItemType getValue(const K &key);
 
     /*
         checks the table to see if a an item with the specified key exists
-        @param key, key of the item to search for
+        @param key, key of the item to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
         @return true if the item exists in the table, and false otherwise
     */
-    bool contains(int key);
+    template <class K>
+    bool contains(const K &key);
+
+    /*
+        inserts a batch of items; the bucket of every item in a group of 'BATCH_SIZE_' is prefetched before any of them is inserted, so that their cache misses overlap instead of happening one after another
+        @param items, pointer to the first of the key-value pairs to insert
+        @param count, number of items to insert
+    */
+    void insertBatch(const std::pair<KeyType, ItemType> *items, size_t count);
+
+    /*
+        looks up a batch of keys; every key in a group of 'BATCH_SIZE_' is hashed and its bucket prefetched before any of them is searched for, so that their cache misses overlap instead of happening one after another
+        @param keys, pointer to the first of the keys to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+        @param count, number of keys to search for
+        @param values, array of at least 'count' pointers; each is set to the value of the matching item, or 'nullptr' if no item has that key. The pointers stay valid until the table is next modified
+    */
+    template <class K>
+    void getValues(const K *keys, size_t count, ItemType **values);
 
     /*
         prints every item currently in the table
     */
     void display();
+
+#ifdef HASH_TABLE_STATS
+    /*
+        collects statistics about the table, such as its load factor and how long its probe sequences are; scans the whole table, so it is meant for monitoring rather than for every operation. Only available when compiled with 'HASH_TABLE_STATS' defined
+        @return the statistics of the table
+    */
+    HashTableStats stats();
+#endif
 private:
+    static const size_t MIN_TABLE_SIZE_ = 16; //initial capacity of the table; it never shrinks below this
+    static constexpr double MAX_TOMBSTONE_RATIO_ = 0.25; //the table is rebuilt at the same size once more than this fraction of its slots are deleted
+    static const size_t BATCH_SIZE_ = 16; //number of keys hashed and prefetched at a time by the batch functions; about as many cache misses as a core can have in flight
+    static const uint8_t EMPTY_ = 0; //state of a slot that has never held an item since the table was last rebuilt; ends every probe sequence
+    static const uint8_t FULL_ = 1; //state of a slot holding an item
+    static const uint8_t TOMBSTONE_ = 2; //state of a slot whose item was removed; probe sequences continue past it, and inserts may reuse it
     size_t item_count_; //current number of items in the table
-    size_t table_size_; //capacity of the hash table; the total number of available buckets
-    HashItem<ItemType> **hash_table_; //array of hash items
+    size_t tombstone_count_; //current number of slots marked as deleted
+    size_t table_size_; //capacity of the hash table; the total number of available buckets; always a power of two so that addresses can be masked instead of divided
+    double max_load_factor_; //the table grows once its load factor exceeds this
+    double min_load_factor_; //the table shrinks once its load factor falls below this
+    HashSlot<KeyType, ItemType> *hash_table_; //array of slots; small items are stored in the slots themselves, and larger ones are pointed to
+    uint8_t *slot_state_; //array of slot states; each slot is either 'EMPTY_', 'FULL_', or 'TOMBSTONE_' (deleted)
+    Hasher hasher_; //hash function object; mixes a key into 64 well-distributed bits
+    KeyEqual key_equal_; //key comparison function object; checks if two keys are equal
+#ifdef HASH_TABLE_STATS
+    size_t rehash_count_ = 0; //number of times the table has been rehashed
+    double rehash_seconds_ = 0; //total time spent rehashing, in seconds
+#endif
 
     /*
         hash function; converts a key to an address
         @param key, key of the item to hash
         @return an integer representing the address of the item
     */
-    int hashFunction(int key);
+    template <class K>
+    size_t hashFunction(const K &key);
 
     /*
         returns the load factor of the hash table
@@ -86,9 +176,44 @@ private:
     double loadFactor();
 
     /*
-        rehashes the table when the load factor exceeds the limit
+        rehashes the table into a table of the specified size, dropping every tombstone; called when the load factor leaves the limits, when too many slots are deleted, and to presize or shrink the table
+        @param new_size, capacity of the new table; a power of two
+    */
+    void rehashTable(size_t new_size);
+
+    /*
+        finds the smallest table size that holds the specified number of items without exceeding the maximum load factor
+        @param count, number of items
+        @return the table size; a power of two
+    */
+    size_t tableSizeFor(size_t count);
+
+    /*
+        places an existing item into the first empty slot of its probe sequence; only used while rehashing, when the table has no tombstones and the keys are already unique
+        @param slot, a slot holding the item to place
+    */
+    void placeItem(HashSlot<KeyType, ItemType> slot);
+
+    /*
+        searches the table for an item with the specified key, using its already computed hash
+        @param key, key of the item to search for
+        @param hash, the full hash of the key
+        @return a pointer to the value of the matching item, or 'nullptr' if the item does not exist
+    */
+    template <class K>
+    ItemType *findValue(const K &key, uint64_t hash);
+
+    /*
+        prefetches the memory that a search for the specified hash reads first
+        @param hash, the full hash of the key
+    */
+    void prefetchBucket(uint64_t hash);
+
+    /*
+        hints the processor to start loading the cache line holding the specified address
+        @param address, the address to prefetch
     */
-    void rehashTable();
+    void prefetch(const void *address);
 };
 
 #include "HashTable.cpp"
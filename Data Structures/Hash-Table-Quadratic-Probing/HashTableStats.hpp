@@ -0,0 +1,37 @@
+/*
+Title: Hash Table Statistics
+Author: Edwin Khew
+Description: Hash table statistics struct declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef HASH_TABLE_STATS_H_
+#define HASH_TABLE_STATS_H_
+
+#include <cstddef> //for size_t
+#include <vector>
+
+/*
+    snapshot of how healthy a hash table is; returned by 'HashTable::stats', which only exists when the table is compiled with 'HASH_TABLE_STATS' defined
+*/
+struct HashTableStats
+{
+    size_t item_count_; //number of items in the table
+    size_t table_size_; //number of buckets (or slots) in the table
+    double load_factor_; //number of items per bucket
+    std::vector<size_t> probe_histogram_; //'probe_histogram_[i]' is the number of items found 'i' probes past their home bucket; for chaining, the number of items at position 'i' of their list
+    size_t max_probe_length_; //largest number of probes past its home bucket that any item needs
+    size_t max_chain_length_; //length of the longest list; for open addressing, the length of the longest run of consecutive occupied slots (cluster)
+    size_t rehash_count_; //number of times the table has been rehashed
+    double rehash_seconds_; //total time spent rehashing, in seconds
+    double tombstone_ratio_; //fraction of the slots marked as deleted; always 0 for tables that do not use tombstones
+    double bytes_per_entry_; //memory used by the table divided by the number of items
+
+    /*
+        prints every statistic
+    */
+    void display() const;
+};
+
+#include "HashTableStats.cpp"
+#endif
@@ -0,0 +1,115 @@
+/*
+Title: Hash Functions
+Author: Edwin Khew
+Description: Hash function (hasher) class declarations.
+Date Created: 10/17/2026
+*/
+
+#ifndef HASHER_H_
+#define HASHER_H_
+
+#include <cstdint>
+#include <string_view>
+
+/*
+    Fibonacci hashing (multiply-shift); the cheapest of the hashers, and spreads sequential keys evenly
+*/
+class FibonacciHash
+{
+public:
+    using is_transparent = void; //lets the table look up keys with any type this hasher accepts, such as a std::string_view for std::string keys
+
+    /*
+        hashes a key by multiplying it with 2^64 divided by the golden ratio
+        @param key, key to hash
+        @return a 64-bit hash of the key; every bit depends on the key, so the table can mask off the low bits
+    */
+    uint64_t operator()(uint64_t key) const;
+
+    /*
+        hashes a string key by multiplying in 8 bytes at a time
+        @param key, key to hash; std::string and C-string keys convert to this without copying
+        @return a 64-bit hash of the key
+    */
+    uint64_t operator()(std::string_view key) const;
+};
+
+/*
+    wyhash-style finalizer; mixes the key with two rounds of 64x64 -> 128-bit multiplication
+*/
+class WyHash
+{
+public:
+    using is_transparent = void; //lets the table look up keys with any type this hasher accepts, such as a std::string_view for std::string keys
+
+    /*
+        hashes a key by folding the two halves of a 128-bit product together
+        @param key, key to hash
+        @return a 64-bit hash of the key
+    */
+    uint64_t operator()(uint64_t key) const;
+
+    /*
+        hashes a string key by mixing in 8 bytes at a time
+        @param key, key to hash; std::string and C-string keys convert to this without copying
+        @return a 64-bit hash of the key
+    */
+    uint64_t operator()(std::string_view key) const;
+private:
+    /*
+        multiplies two values into a 128-bit product and XORs its high and low halves
+        @param a, first value
+        @param b, second value
+        @return the high half of the product XOR the low half
+    */
+    static uint64_t mix(uint64_t a, uint64_t b);
+};
+
+/*
+    CRC32-C based hashing; uses the SSE4.2 'crc32' instruction when available, and a software CRC otherwise
+*/
+class Crc32Hash
+{
+public:
+    using is_transparent = void; //lets the table look up keys with any type this hasher accepts, such as a std::string_view for std::string keys
+
+    /*
+        hashes a key by computing its CRC32-C and spreading the 32-bit CRC over 64 bits
+        @param key, key to hash
+        @return a 64-bit hash of the key; it has no more than 32 bits of entropy, but every bit depends on the whole CRC
+    */
+    uint64_t operator()(uint64_t key) const;
+
+    /*
+        hashes a string key by running its bytes through a CRC32-C computation, 8 bytes at a time, and spreading the CRC over 64 bits
+        @param key, key to hash; std::string and C-string keys convert to this without copying
+        @return a 64-bit hash of the key
+    */
+    uint64_t operator()(std::string_view key) const;
+private:
+    /*
+        computes the CRC32-C of an 8-byte value
+        @param crc, initial CRC value (seed)
+        @param value, value to compute the CRC of
+        @return the 32-bit CRC
+    */
+    static uint32_t crc32(uint32_t crc, uint64_t value);
+
+    /*
+        spreads a 32-bit CRC over 64 bits; a second CRC would not help, since CRCs are linear and any two CRCs of the same key differ by a constant
+        @param crc, the CRC to spread
+        @return a 64-bit hash; distinct CRCs always give distinct hashes
+    */
+    static uint64_t finish(uint32_t crc);
+};
+
+/*
+    reads up to 8 bytes of a string into an integer; used by the hashers to process strings a word at a time
+    @param data, pointer to the first byte to read
+    @param length, number of bytes to read; at most 8, and any missing bytes are read as zero
+    @return the bytes packed into a 64-bit integer
+*/
+uint64_t readChunk(const char *data, size_t length);
+
+#include "Hasher.cpp"
+#endif
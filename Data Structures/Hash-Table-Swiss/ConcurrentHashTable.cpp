@@ -0,0 +1,155 @@
+/*
+Title: Concurrent Hash Table (sharded Swiss tables)
+Author: Edwin Khew
+Description: Concurrent hash table class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <mutex> //for std::unique_lock
+#include <shared_mutex>
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, size_t ShardCount>
+void ConcurrentHashTable<KeyType, ItemType, Hasher, KeyEqual, ShardCount>::insert(const KeyType &key, const ItemType value)
+{
+    uint64_t hash = hasher_(key);
+    Shard &shard = shardFor(hash);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex_); //writers need the shard to themselves
+
+    shard.table_.insert(key, value, hash);
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, size_t ShardCount>
+template<typename K>
+void ConcurrentHashTable<KeyType, ItemType, Hasher, KeyEqual, ShardCount>::remove(const K &key)
+{
+    uint64_t hash = hasher_(key);
+    Shard &shard = shardFor(hash);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex_);
+
+    shard.table_.remove(key, hash);
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, size_t ShardCount>
+void ConcurrentHashTable<KeyType, ItemType, Hasher, KeyEqual, ShardCount>::clear()
+{
+    for(size_t i = 0; i < ShardCount; i++)
+    {
+        std::unique_lock<std::shared_mutex> lock(shards_[i].mutex_);
+
+        shards_[i].table_.clear();
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, size_t ShardCount>
+void ConcurrentHashTable<KeyType, ItemType, Hasher, KeyEqual, ShardCount>::reserve(size_t count)
+{
+    for(size_t i = 0; i < ShardCount; i++)
+    {
+        std::unique_lock<std::shared_mutex> lock(shards_[i].mutex_);
+
+        shards_[i].table_.reserve((count + ShardCount - 1) / ShardCount);
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, size_t ShardCount>
+void ConcurrentHashTable<KeyType, ItemType, Hasher, KeyEqual, ShardCount>::shrinkToFit()
+{
+    for(size_t i = 0; i < ShardCount; i++)
+    {
+        std::unique_lock<std::shared_mutex> lock(shards_[i].mutex_);
+
+        shards_[i].table_.shrinkToFit();
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, size_t ShardCount>
+void ConcurrentHashTable<KeyType, ItemType, Hasher, KeyEqual, ShardCount>::setMaxLoadFactor(double load_factor)
+{
+    for(size_t i = 0; i < ShardCount; i++)
+    {
+        std::unique_lock<std::shared_mutex> lock(shards_[i].mutex_);
+
+        shards_[i].table_.setMaxLoadFactor(load_factor);
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, size_t ShardCount>
+void ConcurrentHashTable<KeyType, ItemType, Hasher, KeyEqual, ShardCount>::setMinLoadFactor(double load_factor)
+{
+    for(size_t i = 0; i < ShardCount; i++)
+    {
+        std::unique_lock<std::shared_mutex> lock(shards_[i].mutex_);
+
+        shards_[i].table_.setMinLoadFactor(load_factor);
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, size_t ShardCount>
+bool ConcurrentHashTable<KeyType, ItemType, Hasher, KeyEqual, ShardCount>::isEmpty()
+{
+    return itemCount() == 0;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, size_t ShardCount>
+size_t ConcurrentHashTable<KeyType, ItemType, Hasher, KeyEqual, ShardCount>::itemCount()
+{
+    size_t count = 0;
+
+    for(size_t i = 0; i < ShardCount; i++)
+    {
+        std::shared_lock<std::shared_mutex> lock(shards_[i].mutex_);
+
+        count += shards_[i].table_.itemCount();
+    }
+
+    return count;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, size_t ShardCount>
+template<typename K>
+ItemType ConcurrentHashTable<KeyType, ItemType, Hasher, KeyEqual, ShardCount>::getValue(const K &key)
+{
+    uint64_t hash = hasher_(key);
+    Shard &shard = shardFor(hash);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex_); //lookups do not modify the shard, so any number of readers can hold the lock at once
+
+    return shard.table_.getValue(key, hash); //throws if no matching key was found; the lock is released either way
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, size_t ShardCount>
+template<typename K>
+bool ConcurrentHashTable<KeyType, ItemType, Hasher, KeyEqual, ShardCount>::contains(const K &key)
+{
+    uint64_t hash = hasher_(key);
+    Shard &shard = shardFor(hash);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex_);
+
+    return shard.table_.contains(key, hash);
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, size_t ShardCount>
+void ConcurrentHashTable<KeyType, ItemType, Hasher, KeyEqual, ShardCount>::display()
+{
+    for(size_t i = 0; i < ShardCount; i++)
+    {
+        std::shared_lock<std::shared_mutex> lock(shards_[i].mutex_);
+
+        if(!shards_[i].table_.isEmpty()) //skip empty shards
+        {
+            std::cout << "Shard " << i << ":" << std::endl;
+            shards_[i].table_.display();
+        }
+    }
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual, size_t ShardCount>
+typename ConcurrentHashTable<KeyType, ItemType, Hasher, KeyEqual, ShardCount>::Shard &ConcurrentHashTable<KeyType, ItemType, Hasher, KeyEqual, ShardCount>::shardFor(uint64_t hash)
+{
+    //use the top byte of the hash; each shard's table picks groups from the low bits and its control bytes from the lowest 7 bits, so the shard choice stays independent of both
+    return shards_[(hash >> 56) & (ShardCount - 1)];
+}
@@ -0,0 +1,120 @@
+/*
+Title: Concurrent Hash Table (sharded Swiss tables)
+Author: Edwin Khew
+Description: Concurrent hash table class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef CONCURRENT_HASH_TABLE_H_
+#define CONCURRENT_HASH_TABLE_H_
+
+#include <cstdint>
+#include <functional> //for std::equal_to
+#include <shared_mutex>
+
+/*
+    a hash table that can be shared between threads; the key space is split across 'ShardCount' independent Swiss tables, each guarded by its own reader/writer lock, so threads only contend when they touch the same shard
+*/
+template <class KeyType, class ItemType, class Hasher = WyHash, class KeyEqual = std::equal_to<>, size_t ShardCount = 64>
+class ConcurrentHashTable
+{
+    static_assert(ShardCount > 0 && (ShardCount & (ShardCount - 1)) == 0, "Shard count must be a power of two!");
+    static_assert(ShardCount <= 256, "Shard count must be at most 256!");
+public:
+    /*
+        inserts a new item into the hash table; if an item with the same key already exists, its value is replaced
+        @param key, key of the item to insert
+        @param value, value of the item to insert
+    */
+    void insert(const KeyType &key, const ItemType value);
+
+    /*
+        removes an item with the specified key from the hash table
+        @param key, key of the item to remove; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+    */
+    template <class K>
+    void remove(const K &key);
+
+    /*
+        removes every item from the hash table; shards are cleared one at a time, so items inserted concurrently into an already cleared shard are kept
+    */
+    void clear();
+
+    /*
+        presizes every shard so that the table holds the specified number of items without rehashing; keys are spread evenly over the shards, so each is presized for its share (a shard that receives more than its share may still rehash)
+        @param count, number of items the table should be able to hold
+    */
+    void reserve(size_t count);
+
+    /*
+        shrinks every shard to the smallest size that holds its current items; shards are shrunk one at a time
+    */
+    void shrinkToFit();
+
+    /*
+        sets the maximum load factor of every shard; see 'HashTable::setMaxLoadFactor'
+        @param load_factor, the new maximum load factor
+    */
+    void setMaxLoadFactor(double load_factor);
+
+    /*
+        sets the minimum load factor of every shard; see 'HashTable::setMinLoadFactor'
+        @param load_factor, the new minimum load factor
+    */
+    void setMinLoadFactor(double load_factor);
+
+    /*
+        checks if the table is currently empty
+        @return true if the table is empty, false otherwise
+    */
+    bool isEmpty();
+
+    /*
+        returns the number of items currently in the table; while other threads are writing, this is only an approximation, since shards are counted one at a time
+        @return an integer representing the number of items currently in the table
+    */
+    size_t itemCount();
+
+    /*
+        returns the item with the specified key; only takes a shared lock, so readers of the same shard never block each other
+        @param key, key of the item to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+        @return the item with the matching key
+    */
+    template <class K>
+    ItemType getValue(const K &key);
+
+    /*
+        checks the table to see if a an item with the specified key exists; only takes a shared lock, so readers of the same shard never block each other
+        @param key, key of the item to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+        @return true if the item exists in the table, and false otherwise
+    */
+    template <class K>
+    bool contains(const K &key);
+
+    /*
+        prints every item currently in the table, one non-empty shard at a time
+    */
+    void display();
+private:
+    /*
+        one independently locked part of the table; aligned to a cache line so that the locks of neighbouring shards never share a line (false sharing)
+    */
+    struct alignas(64) Shard
+    {
+        std::shared_mutex mutex_; //reader/writer lock; readers take it shared, writers take it exclusively
+        HashTable<KeyType, ItemType, Hasher, KeyEqual> table_; //items whose keys map to this shard
+    };
+
+    Shard shards_[ShardCount]; //array of shards
+    Hasher hasher_; //hash function object; selects the shard of a key
+
+    /*
+        finds the shard that an item belongs to; the same hash is then handed to the shard's table, so each key is hashed only once
+        @param hash, hash of the item's key
+        @return a reference to the shard
+    */
+    Shard &shardFor(uint64_t hash);
+};
+
+#include "ConcurrentHashTable.cpp"
+#endif
@@ -0,0 +1,646 @@
+/*
+Title: Hash Table (Swiss table; SIMD control-byte probing)
+Author: Edwin Khew
+Description: Hash table class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <cstdint>
+#include <cstring> //for std::memcmp and std::memcpy
+#include <fstream>
+#include <stdexcept>
+#include <type_traits> //for std::is_trivially_copyable
+#include <utility> //for std::move
+
+#include <fcntl.h> //for open
+#include <sys/mman.h> //for mmap and munmap
+#include <sys/stat.h> //for fstat
+#include <unistd.h> //for close
+#include <stdexcept> //for std::invalid_argument
+
+#ifdef __SSE2__
+#include <emmintrin.h> //SSE2 intrinsics for comparing 16 control bytes at once
+#endif
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+HashTable<KeyType, ItemType, Hasher, KeyEqual>::HashTable():item_count_(0), deleted_count_(0), table_size_(GROUP_SIZE_), max_load_factor_(0.875), min_load_factor_(0.1), mapping_(nullptr), mapping_size_(0)
+{
+    control_ = new int8_t[table_size_];
+    slots_ = new HashItem<KeyType, ItemType>[table_size_];
+
+    //mark each slot as empty
+    for(size_t i = 0; i < table_size_; i++)
+    {
+        control_[i] = EMPTY_;
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+HashTable<KeyType, ItemType, Hasher, KeyEqual>::~HashTable()
+{
+    releaseStorage(control_, slots_);
+    control_ = nullptr;
+    slots_ = nullptr;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::insert(const KeyType &key, ItemType value)
+{
+    insert(key, value, hashFunction(key)); //hash the key to get its group and control byte
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::insert(const KeyType &key, ItemType value, uint64_t hash)
+{
+    size_t index = findIndex(key, hash); //the same hash serves both the search for the key and the search for a free slot
+
+    //if the key already exists, only replace its value
+    if(index != table_size_)
+    {
+        slots_[index].setValue(value);
+        return;
+    }
+
+    index = findInsertIndex(hash);
+
+    if(control_[index] == DELETED_) //reusing a deleted slot
+    {
+        deleted_count_--;
+    }
+
+    control_[index] = static_cast<int8_t>(hash & 0x7F); //store the low 7 bits of the hash; high bit clear marks the slot as full
+    slots_[index] = HashItem<KeyType, ItemType>(key, value);
+
+    item_count_++;
+
+    //if the load factor exceeds the specified limit after insertion of the new item, rehash the table; a Swiss table can run fuller than the other tables since a group rarely fills up
+    //the table only grows if the items themselves fill more than half of the limit; otherwise most of the used slots are deleted, and rebuilding at the same size is enough
+    if(loadFactor() > max_load_factor_)
+    {
+        rehashTable((item_count_ > table_size_ * max_load_factor_ / 2) ? 2 * table_size_ : table_size_);
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::remove(const K &key)
+{
+    remove(key, hashFunction(key));
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::remove(const K &key, uint64_t hash)
+{
+    size_t index = findIndex(key, hash);
+
+    if(index == table_size_) //item does not exist
+    {
+        return;
+    }
+
+    size_t group_start = index - (index % GROUP_SIZE_); //index of the first slot in the item's group
+
+    //if the group still has an empty slot, then no probe sequence has ever continued past this group, so the slot can become empty again instead of deleted
+    if(matchByte(control_ + group_start, EMPTY_) != 0)
+    {
+        control_[index] = EMPTY_;
+    }
+    else
+    {
+        control_[index] = DELETED_;
+        deleted_count_++;
+    }
+
+    slots_[index].setValue(ItemType()); //release the value held by the slot
+
+    item_count_--;
+
+    //if the load factor (not counting deleted slots) falls below the specified limit after removal of the item, shrink and rehash the table
+    if((1.0 * item_count_) / table_size_ < min_load_factor_ && table_size_ > GROUP_SIZE_)
+    {
+        rehashTable(table_size_ / 2);
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::clear()
+{
+    for(size_t i = 0; i < table_size_; i++) //loop through each slot of the array
+    {
+        if(control_[i] >= 0) //release the value held by every full slot
+        {
+            slots_[i].setValue(ItemType());
+        }
+
+        control_[i] = EMPTY_;
+    }
+
+    item_count_ = 0;
+    deleted_count_ = 0;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::reserve(size_t count)
+{
+    size_t new_size = tableSizeFor(count);
+
+    if(new_size > table_size_)
+    {
+        rehashTable(new_size);
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::shrinkToFit()
+{
+    size_t new_size = tableSizeFor(item_count_);
+
+    if(new_size < table_size_)
+    {
+        rehashTable(new_size);
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+double HashTable<KeyType, ItemType, Hasher, KeyEqual>::maxLoadFactor()
+{
+    return max_load_factor_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::setMaxLoadFactor(double load_factor)
+{
+    if(!(load_factor > 0 && load_factor < 1) || load_factor <= 2 * min_load_factor_)
+    {
+        throw(std::invalid_argument("Load factor out of range!"));
+    }
+
+    max_load_factor_ = load_factor;
+
+    reserve(item_count_); //grow the table if it is now over the limit
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+double HashTable<KeyType, ItemType, Hasher, KeyEqual>::minLoadFactor()
+{
+    return min_load_factor_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::setMinLoadFactor(double load_factor)
+{
+    if(!(load_factor >= 0) || 2 * load_factor >= max_load_factor_)
+    {
+        throw(std::invalid_argument("Load factor out of range!"));
+    }
+
+    min_load_factor_ = load_factor;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+bool HashTable<KeyType, ItemType, Hasher, KeyEqual>::isEmpty()
+{
+    return item_count_ == 0;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::itemCount()
+{
+    return item_count_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+ItemType HashTable<KeyType, ItemType, Hasher, KeyEqual>::getValue(const K &key)
+{
+    return getValue(key, hashFunction(key));
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+ItemType HashTable<KeyType, ItemType, Hasher, KeyEqual>::getValue(const K &key, uint64_t hash)
+{
+    size_t index = findIndex(key, hash);
+
+    if(index != table_size_) //when an item with a matching key is found, return its value
+    {
+        return slots_[index].getValue();
+    }
+
+    //if no matching key was found, throw an exception
+    throw(std::out_of_range("Position out of range!"));
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+bool HashTable<KeyType, ItemType, Hasher, KeyEqual>::contains(const K &key)
+{
+    return findIndex(key) != table_size_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+bool HashTable<KeyType, ItemType, Hasher, KeyEqual>::contains(const K &key, uint64_t hash)
+{
+    return findIndex(key, hash) != table_size_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::insertBatch(const std::pair<KeyType, ItemType> *items, size_t count)
+{
+    uint64_t hashes[BATCH_SIZE_]; //hashes of the current group of items
+
+    for(size_t start = 0; start < count; start += BATCH_SIZE_)
+    {
+        size_t end = (start + BATCH_SIZE_ < count) ? start + BATCH_SIZE_ : count; //one past the last item of the group
+
+        //hash every item in the group and prefetch its bucket first
+        for(size_t i = start; i < end; i++)
+        {
+            hashes[i - start] = hasher_(items[i].first);
+            prefetchBucket(hashes[i - start]);
+        }
+
+        //then insert them; by now most of their buckets are already in the cache
+        for(size_t i = start; i < end; i++)
+        {
+            insert(items[i].first, items[i].second, hashes[i - start]);
+        }
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::getValues(const K *keys, size_t count, ItemType **values)
+{
+    uint64_t hashes[BATCH_SIZE_]; //hashes of the current group of keys
+
+    for(size_t start = 0; start < count; start += BATCH_SIZE_)
+    {
+        size_t end = (start + BATCH_SIZE_ < count) ? start + BATCH_SIZE_ : count; //one past the last key of the group
+
+        //hash every key in the group and prefetch its bucket first
+        for(size_t i = start; i < end; i++)
+        {
+            hashes[i - start] = hasher_(keys[i]);
+            prefetchBucket(hashes[i - start]);
+        }
+
+        //then search for them; by now most of their buckets are already in the cache
+        for(size_t i = start; i < end; i++)
+        {
+            values[i] = findValue(keys[i], hashes[i - start]);
+        }
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::saveSnapshot(const char *path)
+{
+    static_assert(std::is_trivially_copyable<HashItem<KeyType, ItemType>>::value, "Snapshots need trivially copyable keys and values!");
+
+    SnapshotHeader header = {};
+    std::memcpy(header.magic_, "SWISSTBL", sizeof(header.magic_));
+    header.version_ = SNAPSHOT_VERSION_;
+    header.slot_size_ = sizeof(HashItem<KeyType, ItemType>);
+    header.key_size_ = sizeof(KeyType);
+    header.value_size_ = sizeof(ItemType);
+    header.hash_check_ = hasher_(KeyType());
+    header.table_size_ = table_size_;
+    header.item_count_ = item_count_;
+    header.deleted_count_ = deleted_count_;
+    header.control_offset_ = (sizeof(SnapshotHeader) + SNAPSHOT_ALIGNMENT_ - 1) / SNAPSHOT_ALIGNMENT_ * SNAPSHOT_ALIGNMENT_;
+    header.slots_offset_ = header.control_offset_ + (table_size_ + SNAPSHOT_ALIGNMENT_ - 1) / SNAPSHOT_ALIGNMENT_ * SNAPSHOT_ALIGNMENT_;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+    if(!file)
+    {
+        throw(std::runtime_error("Could not open snapshot!"));
+    }
+
+    const char padding[SNAPSHOT_ALIGNMENT_] = {}; //zero bytes written between the parts so each starts aligned
+
+    file.write(reinterpret_cast<const char *>(&header), sizeof(SnapshotHeader));
+    file.write(padding, header.control_offset_ - sizeof(SnapshotHeader));
+    file.write(reinterpret_cast<const char *>(control_), table_size_);
+    file.write(padding, header.slots_offset_ - header.control_offset_ - table_size_);
+    file.write(reinterpret_cast<const char *>(slots_), table_size_ * sizeof(HashItem<KeyType, ItemType>));
+
+    if(!file)
+    {
+        throw(std::runtime_error("Could not write snapshot!"));
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::loadSnapshot(const char *path)
+{
+    static_assert(std::is_trivially_copyable<HashItem<KeyType, ItemType>>::value, "Snapshots need trivially copyable keys and values!");
+
+    int file = open(path, O_RDONLY);
+
+    if(file < 0)
+    {
+        throw(std::runtime_error("Could not open snapshot!"));
+    }
+
+    struct stat info;
+
+    if(fstat(file, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(SnapshotHeader))
+    {
+        close(file);
+        throw(std::runtime_error("Invalid snapshot!"));
+    }
+
+    size_t size = info.st_size;
+
+    //map the whole file privately; nothing is read until a page is touched, and writes to the table go to private copies of the pages instead of the file
+    void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+    close(file); //the mapping stays valid after the file is closed
+
+    if(mapping == MAP_FAILED)
+    {
+        throw(std::runtime_error("Could not map snapshot!"));
+    }
+
+    const SnapshotHeader *header = static_cast<const SnapshotHeader *>(mapping);
+
+    //check that the snapshot was written by a table of the same types, and that the arrays it describes fit in the file
+    bool valid = std::memcmp(header->magic_, "SWISSTBL", sizeof(header->magic_)) == 0
+        && header->version_ == SNAPSHOT_VERSION_
+        && header->slot_size_ == sizeof(HashItem<KeyType, ItemType>)
+        && header->key_size_ == sizeof(KeyType) && header->value_size_ == sizeof(ItemType)
+        && header->hash_check_ == hasher_(KeyType())
+        && header->table_size_ >= GROUP_SIZE_ && (header->table_size_ & (header->table_size_ - 1)) == 0
+        && header->control_offset_ % SNAPSHOT_ALIGNMENT_ == 0 && header->slots_offset_ % SNAPSHOT_ALIGNMENT_ == 0
+        && header->control_offset_ + header->table_size_ <= header->slots_offset_
+        && header->slots_offset_ + header->table_size_ * sizeof(HashItem<KeyType, ItemType>) <= size;
+
+    if(!valid)
+    {
+        munmap(mapping, size);
+        throw(std::runtime_error("Invalid snapshot!"));
+    }
+
+    releaseStorage(control_, slots_); //drop the current contents of the table
+
+    mapping_ = mapping;
+    mapping_size_ = size;
+    control_ = reinterpret_cast<int8_t *>(static_cast<char *>(mapping) + header->control_offset_);
+    slots_ = reinterpret_cast<HashItem<KeyType, ItemType> *>(static_cast<char *>(mapping) + header->slots_offset_);
+    table_size_ = header->table_size_;
+    item_count_ = header->item_count_;
+    deleted_count_ = header->deleted_count_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::display()
+{
+    for(size_t i = 0; i < table_size_; i++)
+    {
+        if(control_[i] < 0) //empty or deleted slot
+        {
+            std::cout << i << " " << std::endl;
+        }
+        else
+        {
+            std::cout << i << " " << slots_[i].getValue() << std::endl;
+        }
+    }
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+uint64_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::hashFunction(const K &key)
+{
+    return hasher_(key);
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::findIndex(const K &key)
+{
+    return findIndex(key, hashFunction(key)); //hash the key to get its group and control byte
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::findIndex(const K &key, uint64_t hash)
+{
+    int8_t tag = static_cast<int8_t>(hash & 0x7F); //control byte that a matching item would have
+    size_t group_mask = (table_size_ / GROUP_SIZE_) - 1; //number of groups is a power of two, so masking replaces modulo
+    size_t group = (hash >> 7) & group_mask; //index of the first group to probe
+
+    //probe groups using triangular increments (1, 2, 3, ...), which visits every group when the group count is a power of two
+    for(size_t stride = 1; ; stride++)
+    {
+        const int8_t *group_ptr = control_ + group * GROUP_SIZE_;
+
+        //only compare keys in slots whose control byte matches; a 7-bit tag rules out all but ~1/128 of the non-matching items
+        for(uint32_t mask = matchByte(group_ptr, tag); mask != 0; mask &= mask - 1)
+        {
+            size_t index = group * GROUP_SIZE_ + lowestBit(mask);
+
+            if(key_equal_(slots_[index].getKey(), key))
+            {
+                return index;
+            }
+        }
+
+        //once a group with an empty slot is reached, the item does not exist; an insert would have stopped here
+        if(matchByte(group_ptr, EMPTY_) != 0)
+        {
+            return table_size_;
+        }
+
+        group = (group + stride) & group_mask; //move to the next group in the probe sequence
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::findInsertIndex(uint64_t hash)
+{
+    size_t group_mask = (table_size_ / GROUP_SIZE_) - 1;
+    size_t group = (hash >> 7) & group_mask;
+
+    //the load factor limit guarantees at least one empty slot, so the loop always terminates
+    for(size_t stride = 1; ; stride++)
+    {
+        uint32_t mask = matchEmptyOrDeleted(control_ + group * GROUP_SIZE_);
+
+        if(mask != 0)
+        {
+            return group * GROUP_SIZE_ + lowestBit(mask);
+        }
+
+        group = (group + stride) & group_mask;
+    }
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+uint32_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::matchByte(const int8_t *group, int8_t byte)
+{
+#ifdef __SSE2__
+    __m128i control = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group)); //load all 16 control bytes of the group
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8(byte)))); //compare every byte at once and gather the results into a bitmask
+#else
+    uint32_t mask = 0;
+
+    for(size_t i = 0; i < GROUP_SIZE_; i++)
+    {
+        if(group[i] == byte)
+        {
+            mask |= 1U << i;
+        }
+    }
+
+    return mask;
+#endif
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+uint32_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::matchEmptyOrDeleted(const int8_t *group)
+{
+#ifdef __SSE2__
+    __m128i control = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+    return static_cast<uint32_t>(_mm_movemask_epi8(control)); //gathers the high bit of every control byte
+#else
+    uint32_t mask = 0;
+
+    for(size_t i = 0; i < GROUP_SIZE_; i++)
+    {
+        if(group[i] < 0)
+        {
+            mask |= 1U << i;
+        }
+    }
+
+    return mask;
+#endif
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+int HashTable<KeyType, ItemType, Hasher, KeyEqual>::lowestBit(uint32_t mask)
+{
+#if defined(__GNUC__)
+    return __builtin_ctz(mask);
+#else
+    int position = 0;
+
+    while((mask & 1U) == 0)
+    {
+        mask >>= 1;
+        position++;
+    }
+
+    return position;
+#endif
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+double HashTable<KeyType, ItemType, Hasher, KeyEqual>::loadFactor()
+{
+    return (1.0 * (item_count_ + deleted_count_)) / table_size_;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+size_t HashTable<KeyType, ItemType, Hasher, KeyEqual>::tableSizeFor(size_t count)
+{
+    size_t size = GROUP_SIZE_;
+
+    //double the table size until the items fit without exceeding the maximum load factor
+    while(count > size * max_load_factor_)
+    {
+        size = 2 * size;
+    }
+
+    return size;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::rehashTable(size_t new_size)
+{
+    int8_t *temp_control = control_; //create a temporary copy of the old control bytes
+    HashItem<KeyType, ItemType> *temp_slots = slots_; //create a temporary copy of the old slots
+
+    size_t temp_size = table_size_; //create a temporary copy of the old table size
+
+    table_size_ = new_size;
+
+    control_ = new int8_t[table_size_];
+    slots_ = new HashItem<KeyType, ItemType>[table_size_];
+    deleted_count_ = 0;
+
+    for(size_t i = 0; i < table_size_; i++)
+    {
+        control_[i] = EMPTY_;
+    }
+
+    //loop through the temporary copy and move each item into the new table; keys are already unique, so no lookups are needed
+    for(size_t i = 0; i < temp_size; i++)
+    {
+        if(temp_control[i] >= 0)
+        {
+            uint64_t hash = hashFunction(temp_slots[i].getKey());
+            size_t index = findInsertIndex(hash);
+
+            control_[index] = static_cast<int8_t>(hash & 0x7F);
+            slots_[index] = std::move(temp_slots[i]);
+        }
+    }
+
+    //delete the old table and free memory
+    releaseStorage(temp_control, temp_slots);
+    temp_control = nullptr;
+    temp_slots = nullptr;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+template<typename K>
+ItemType *HashTable<KeyType, ItemType, Hasher, KeyEqual>::findValue(const K &key, uint64_t hash)
+{
+    size_t index = findIndex(key, hash);
+
+    return (index != table_size_) ? slots_[index].getValuePointer() : nullptr;
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::prefetchBucket(uint64_t hash)
+{
+    size_t group = (hash >> 7) & ((table_size_ / GROUP_SIZE_) - 1); //first group of the probe sequence
+
+    prefetch(control_ + group * GROUP_SIZE_);
+    prefetch(slots_ + group * GROUP_SIZE_);
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::prefetch(const void *address)
+{
+#if defined(__GNUC__)
+    __builtin_prefetch(address);
+#else
+    (void)address; //no portable prefetch; the batch functions still work, just without the overlap
+#endif
+}
+
+template<typename KeyType, typename ItemType, typename Hasher, typename KeyEqual>
+void HashTable<KeyType, ItemType, Hasher, KeyEqual>::releaseStorage(int8_t *control, HashItem<KeyType, ItemType> *slots)
+{
+    if(mapping_ != nullptr) //the arrays point into a snapshot; they were never allocated, and their items need no destructors since they are trivially copyable
+    {
+        munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+        mapping_size_ = 0;
+    }
+    else
+    {
+        delete[] control;
+        delete[] slots;
+    }
+}
@@ -0,0 +1,321 @@
+/*
+Title: Hash Table (Swiss table; SIMD control-byte probing)
+Author: Edwin Khew
+Description: Hash table class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef HASH_TABLE_H_
+#define HASH_TABLE_H_
+
+#include <cstdint>
+#include <functional> //for std::equal_to
+#include <utility> //for std::pair
+
+template <class KeyType, class ItemType, class Hasher = WyHash, class KeyEqual = std::equal_to<>>
+class HashTable
+{
+public:
+    /*
+        default constructor
+    */
+    HashTable();
+
+    /*
+        destructor
+    */
+    ~HashTable();
+
+    HashTable(const HashTable &) = delete;
+    HashTable &operator=(const HashTable &) = delete;
+
+    /*
+        inserts a new item into the hash table; if an item with the same key already exists, its value is replaced
+        @param key, key of the item to insert
+        @param value, value of the item to insert
+    */
+    void insert(const KeyType &key, const ItemType value);
+
+    /*
+        inserts a new item whose key was already hashed by the caller, such as a caller that used the hash to pick this table; the key is not hashed again
+        @param key, key of the item to insert
+        @param value, value of the item to insert
+        @param hash, hash of the key from a hasher of the same type as the table's
+    */
+    void insert(const KeyType &key, const ItemType value, uint64_t hash);
+
+    /*
+        removes an item with the specified key from the hash table
+        @param key, key of the item to remove; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+    */
+    template <class K>
+    void remove(const K &key);
+
+    /*
+        removes an item whose key was already hashed by the caller; the key is not hashed again
+        @param key, key of the item to remove
+        @param hash, hash of the key from a hasher of the same type as the table's
+    */
+    template <class K>
+    void remove(const K &key, uint64_t hash);
+
+    /*
+        removes every item from the hash table
+    */
+    void clear();
+
+    /*
+        presizes the table to hold the specified number of items without exceeding the maximum load factor, so that inserting them does not rehash; never shrinks the table
+        @param count, number of items the table should be able to hold
+    */
+    void reserve(size_t count);
+
+    /*
+        shrinks the table to the smallest size that holds its current items without exceeding the maximum load factor, freeing the memory left over from removed items
+    */
+    void shrinkToFit();
+
+    /*
+        returns the maximum load factor; the table grows once an insert takes the load factor above it
+        @return a decimal number representing the maximum load factor
+    */
+    double maxLoadFactor();
+
+    /*
+        sets the maximum load factor; if the table is already fuller than this, it is grown right away
+        @param load_factor, the new maximum load factor; must be greater than 0 and below 1, and more than twice the minimum load factor
+    */
+    void setMaxLoadFactor(double load_factor);
+
+    /*
+        returns the minimum load factor; the table is halved once a remove takes the load factor below it
+        @return a decimal number representing the minimum load factor
+    */
+    double minLoadFactor();
+
+    /*
+        sets the minimum load factor; 0 stops the table from ever shrinking on its own
+        @param load_factor, the new minimum load factor; must be at least 0, and less than half the maximum load factor so that a halved table is not grown again by the next insert
+    */
+    void setMinLoadFactor(double load_factor);
+
+    /*
+        checks if the table is currently empty
+        @return true if the table is empty, false otherwise
+    */
+    bool isEmpty();
+
+    /*
+        returns the number of items currently in the table
+        @return an integer representing the number of items currently in the table
+    */
+    size_t itemCount();
+
+    /*
+        returns the item with the specified key
+        @param key, key of the item to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+        @return the item with the matching key
+    */
+    template <class K>
+    ItemType getValue(const K &key);
+
+    /*
+        returns the item with a key that was already hashed by the caller; the key is not hashed again
+        @param key, key of the item to search for
+        @param hash, hash of the key from a hasher of the same type as the table's
+        @return the item with the matching key
+    */
+    template <class K>
+    ItemType getValue(const K &key, uint64_t hash);
+
+    /*
+        checks the table to see if a an item with the specified key exists
+        @param key, key of the item to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+        @return true if the item exists in the table, and false otherwise
+    */
+    template <class K>
+    bool contains(const K &key);
+
+    /*
+        checks the table for an item with a key that was already hashed by the caller; the key is not hashed again
+        @param key, key of the item to search for
+        @param hash, hash of the key from a hasher of the same type as the table's
+        @return true if the item exists in the table, and false otherwise
+    */
+    template <class K>
+    bool contains(const K &key, uint64_t hash);
+
+    /*
+        inserts a batch of items; the bucket of every item in a group of 'BATCH_SIZE_' is prefetched before any of them is inserted, so that their cache misses overlap instead of happening one after another
+        @param items, pointer to the first of the key-value pairs to insert
+        @param count, number of items to insert
+    */
+    void insertBatch(const std::pair<KeyType, ItemType> *items, size_t count);
+
+    /*
+        looks up a batch of keys; every key in a group of 'BATCH_SIZE_' is hashed and its bucket prefetched before any of them is searched for, so that their cache misses overlap instead of happening one after another
+        @param keys, pointer to the first of the keys to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+        @param count, number of keys to search for
+        @param values, array of at least 'count' pointers; each is set to the value of the matching item, or 'nullptr' if no item has that key. The pointers stay valid until the table is next modified
+    */
+    template <class K>
+    void getValues(const K *keys, size_t count, ItemType **values);
+
+    /*
+        writes the table to a snapshot file; the control bytes and slots are written exactly as they are laid out in memory, so 'loadSnapshot' can use the file without rebuilding anything. Only available when both the key and value types are trivially copyable
+        @param path, path of the file to write
+    */
+    void saveSnapshot(const char *path);
+
+    /*
+        replaces the contents of the table with a snapshot file written by 'saveSnapshot'; the file is memory-mapped and queried in place, so loading costs a single 'mmap' and pages are only read from disk as lookups touch them. The mapping is private, so modifying the table never changes the file. Only available on POSIX systems, and when both the key and value types are trivially copyable
+        @param path, path of the file to load
+    */
+    void loadSnapshot(const char *path);
+
+    /*
+        prints every item currently in the table
+    */
+    void display();
+private:
+    /*
+        layout of the start of a snapshot file; the control bytes and slots follow at the recorded offsets
+    */
+    struct SnapshotHeader
+    {
+        char magic_[8]; //identifies the file as a Swiss table snapshot
+        uint32_t version_; //version of the snapshot format
+        uint32_t slot_size_; //size of one slot in bytes; guards against loading a snapshot of different key or value types
+        uint32_t key_size_; //size of a key in bytes
+        uint32_t value_size_; //size of a value in bytes
+        uint64_t hash_check_; //hash of a default key; guards against loading a snapshot written with a different hasher
+        uint64_t table_size_; //capacity of the table
+        uint64_t item_count_; //number of items in the table
+        uint64_t deleted_count_; //number of slots marked as deleted
+        uint64_t control_offset_; //offset of the control bytes from the start of the file
+        uint64_t slots_offset_; //offset of the slots from the start of the file
+    };
+
+    static const size_t GROUP_SIZE_ = 16; //number of slots probed at once; one SSE2 register of control bytes
+    static const int8_t EMPTY_ = -128; //control byte of a slot that has never been used (0b10000000)
+    static const int8_t DELETED_ = -2; //control byte of a slot whose item was removed (0b11111110)
+    static const uint32_t SNAPSHOT_VERSION_ = 1; //version written to and expected from snapshot files
+    static const size_t SNAPSHOT_ALIGNMENT_ = 64; //alignment of the arrays in a snapshot file; a cache line, so that mapped groups line up just like allocated ones
+    static const size_t BATCH_SIZE_ = 16; //number of keys hashed and prefetched at a time by the batch functions; about as many cache misses as a core can have in flight
+
+    size_t item_count_; //current number of items in the table
+    size_t deleted_count_; //current number of slots marked as deleted
+    size_t table_size_; //capacity of the hash table; always a power of two and a multiple of 'GROUP_SIZE_'
+    double max_load_factor_; //the table grows once its load factor exceeds this
+    double min_load_factor_; //the table shrinks once its load factor falls below this
+    int8_t *control_; //array of control bytes; one per slot, holding either 'EMPTY_', 'DELETED_', or the low 7 bits of the item's hash
+    HashItem<KeyType, ItemType> *slots_; //array of hash items stored inline; only slots with a full control byte hold a valid item
+    Hasher hasher_; //hash function object; mixes a key into 64 well-distributed bits
+    KeyEqual key_equal_; //key comparison function object; checks if two keys are equal
+    void *mapping_; //start of the memory-mapped snapshot that 'control_' and 'slots_' point into; 'nullptr' when they were allocated instead
+    size_t mapping_size_; //size of the mapping in bytes
+
+    /*
+        hash function; hashes a key with the table's hasher
+        @param key, key of the item to hash
+        @return the full hash of the key; the upper bits select a group and the lower 7 bits are stored in the control byte
+    */
+    template <class K>
+    uint64_t hashFunction(const K &key);
+
+    /*
+        searches the table for an item with the specified key
+        @param key, key of the item to search for; can be any type the hasher and key comparator accept, such as a std::string_view for std::string keys
+        @return the index of the slot holding the item, or 'table_size_' if the item does not exist
+    */
+    template <class K>
+    size_t findIndex(const K &key);
+
+    /*
+        searches the table for an item with the specified key, using its already computed hash
+        @param key, key of the item to search for
+        @param hash, the full hash of the key
+        @return the index of the slot holding the item, or 'table_size_' if the item does not exist
+    */
+    template <class K>
+    size_t findIndex(const K &key, uint64_t hash);
+
+    /*
+        finds the first empty or deleted slot in the probe sequence of the specified hash
+        @param hash, the full hash of the key to insert
+        @return the index of the slot where the item can be placed
+    */
+    size_t findInsertIndex(uint64_t hash);
+
+    /*
+        compares every control byte in a group against the specified byte
+        @param group, pointer to the first control byte of the group
+        @param byte, the control byte to search for
+        @return a bitmask where bit 'i' is set if the i'th control byte of the group matches
+    */
+    uint32_t matchByte(const int8_t *group, int8_t byte);
+
+    /*
+        finds every empty or deleted slot in a group; both have their high bit set, while full slots do not
+        @param group, pointer to the first control byte of the group
+        @return a bitmask where bit 'i' is set if the i'th slot of the group is empty or deleted
+    */
+    uint32_t matchEmptyOrDeleted(const int8_t *group);
+
+    /*
+        returns the index of the lowest set bit of a non-zero bitmask
+        @param mask, the bitmask to search
+        @return an integer representing the position of the lowest set bit
+    */
+    int lowestBit(uint32_t mask);
+
+    /*
+        returns the load factor of the hash table; deleted slots are counted since they lengthen probe sequences just like items do
+        @return a decimal number representing the current load factor of the table
+    */
+    double loadFactor();
+
+    /*
+        rehashes the table into a table of the specified size, purging every deleted slot; called when the load factor leaves the limits, and to presize or shrink the table
+        @param new_size, capacity of the new table; a power of two and a multiple of 'GROUP_SIZE_'
+    */
+    void rehashTable(size_t new_size);
+
+    /*
+        finds the smallest table size that holds the specified number of items without exceeding the maximum load factor
+        @param count, number of items
+        @return the table size; a power of two
+    */
+    size_t tableSizeFor(size_t count);
+
+    /*
+        searches the table for an item with the specified key, using its already computed hash
+        @param key, key of the item to search for
+        @param hash, the full hash of the key
+        @return a pointer to the value of the matching item, or 'nullptr' if the item does not exist
+    */
+    template <class K>
+    ItemType *findValue(const K &key, uint64_t hash);
+
+    /*
+        prefetches the memory that a search for the specified hash reads first
+        @param hash, the full hash of the key
+    */
+    void prefetchBucket(uint64_t hash);
+
+    /*
+        hints the processor to start loading the cache line holding the specified address
+        @param address, the address to prefetch
+    */
+    void prefetch(const void *address);
+
+    /*
+        frees the arrays of control bytes and slots; unmaps them instead if they point into a snapshot
+        @param control, the array of control bytes
+        @param slots, the array of slots
+    */
+    void releaseStorage(int8_t *control, HashItem<KeyType, ItemType> *slots);
+};
+
+#include "HashTable.cpp"
+#endif
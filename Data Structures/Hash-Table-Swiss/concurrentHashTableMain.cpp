@@ -0,0 +1,100 @@
+/*
+Title: Concurrent Hash Table (sharded Swiss tables)
+Author: Edwin Khew
+Description: Concurrent hash table test file.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "HashItem.hpp"
+#include "Hasher.hpp"
+#include "HashTable.hpp"
+#include "ConcurrentHashTable.hpp"
+
+using namespace std;
+
+int main()
+{
+    ConcurrentHashTable<int, string> myTable;
+    //ConcurrentHashTable<int, string, WyHash, std::equal_to<>, 16> myTable; //shard count test; must be a power of two
+
+    const int THREAD_COUNT = 4;
+    const int ITEMS_PER_THREAD = 1000;
+
+    vector<thread> threads;
+
+    //each writer inserts its own range of keys
+    for(int t = 0; t < THREAD_COUNT; t++)
+    {
+        threads.push_back(thread([&myTable, t, ITEMS_PER_THREAD]()
+        {
+            for(int i = t * ITEMS_PER_THREAD; i < (t + 1) * ITEMS_PER_THREAD; i++)
+            {
+                myTable.insert(i, to_string(i));
+            }
+        }));
+    }
+
+    for(auto &i : threads)
+    {
+        i.join();
+    }
+
+    threads.clear();
+
+    cout << "Is Empty: " << myTable.isEmpty() << endl;
+    cout << "Item Count: " << myTable.itemCount() << endl;
+
+    //readers look up every key while one writer removes the odd keys
+    int found[THREAD_COUNT] = {};
+
+    for(int t = 0; t < THREAD_COUNT; t++)
+    {
+        threads.push_back(thread([&myTable, &found, t, THREAD_COUNT, ITEMS_PER_THREAD]()
+        {
+            for(int i = 0; i < THREAD_COUNT * ITEMS_PER_THREAD; i++)
+            {
+                found[t] += myTable.contains(i);
+            }
+        }));
+    }
+
+    threads.push_back(thread([&myTable, THREAD_COUNT, ITEMS_PER_THREAD]()
+    {
+        for(int i = 1; i < THREAD_COUNT * ITEMS_PER_THREAD; i += 2)
+        {
+            myTable.remove(i);
+        }
+    }));
+
+    for(auto &i : threads)
+    {
+        i.join();
+    }
+
+    for(int t = 0; t < THREAD_COUNT; t++)
+    {
+        cout << "Found by reader " << t << ": " << found[t] << endl; //somewhere between half and all of the keys, depending on how far the removals got
+    }
+
+    cout << "Item Count (After remove): " << myTable.itemCount() << endl;
+    cout << "Contains: " << myTable.contains(302) << endl;
+
+    try
+    {
+        cout << "Get Value: " << myTable.getValue(302) << endl;
+        cout << "Get Value: " << myTable.getValue(301) << endl;
+    }
+    catch(const std::out_of_range& problem)
+    {
+        cout << "Item not found!" << endl;
+    }
+
+    myTable.clear();
+
+    cout << endl << "Is Empty (After clear): " << myTable.isEmpty() << endl;
+    cout << "Item Count (After clear): " << myTable.itemCount() << endl;
+}
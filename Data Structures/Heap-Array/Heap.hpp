@@ -8,6 +8,8 @@ Date Created: 6/21/2021
 #ifndef HEAP_H_
 #define HEAP_H_
 
+#include <cstddef>
+
 template <class ItemType>
 class Heap
 {
@@ -17,22 +19,61 @@ public:
     */
     Heap();
 
+    /*
+        builds a heap from a range of items in O(n) time, by heapifying every node starting from the deepest non-leaf node; much faster than inserting the items one at a time
+        @param first, iterator to the first item of the range
+        @param last, iterator to one past the last item of the range
+    */
+    template <class InputIterator>
+    Heap(InputIterator first, InputIterator last);
+
+    /*
+        destructor
+    */
+    ~Heap();
+
+    /*
+        copy constructor
+        @param heap, heap to be copied
+    */
+    Heap(const Heap &heap);
+
+    Heap &operator=(const Heap &) = delete;
+
     /*
         inserts a new item into the heap
         @param new_item, item to insert into the heap
     */
     void insert(const ItemType &new_item);
 
+    /*
+        inserts a new item into the heap, moving it in instead of copying it; also lets the heap hold move-only items
+        @param new_item, item to move into the heap
+    */
+    void insert(ItemType &&new_item);
+
     /*
         removes the item in the root node of the heap
     */
     void remove();
 
     /*
-        removes every node from the heap
+        removes every node from the heap; keeps the memory for reuse
     */
     void clear();
 
+    /*
+        makes room for the specified number of items, so that inserting them does not reallocate
+        @param count, number of items the heap should be able to hold
+    */
+    void reserve(size_t count);
+
+    /*
+        returns the number of items currently in the heap
+        @return an integer representing the number of items in the heap
+    */
+    size_t itemCount() const;
+
     /*
         returns the current height of the heap; counts the height in nodes
         @return integer representing the height of the heap
@@ -46,11 +87,17 @@ public:
     bool isEmpty() const;
 
     /*
-        checks if the heap is full
-        @return true if the heap is full, and false otherwise
+        checks if the heap is full; the array grows as needed, so the heap never is
+        @return always false
     */
     bool isFull() const;
 
+    /*
+        returns the item in the root node of the heap
+        @return a reference to the root item; valid until the heap is next modified
+    */
+    const ItemType &top() const;
+
     /*
         prints the item in the root node of the heap
     */
@@ -61,21 +108,40 @@ public:
     */
     void display() const;
 private:
-    static const int CAPACITY = 20; //capacity of the array heap
-    ItemType heap_[CAPACITY]; //the array heap itself
+    static const size_t MIN_CAPACITY_ = 16; //capacity of the first allocation
+
+    ItemType *heap_; //the array heap itself; only the first 'item_count_' slots hold items
     size_t item_count_; //total number of items currently in the heap
+    size_t capacity_; //number of items the array can hold before it has to grow
 
     /*
         heapifies the array in a bottom-up approach
         @param item_index, index of item to check with parent to see if heap conditions are satisfied
     */
-    void insertHeapify(const ItemType &item_index);
+    void insertHeapify(size_t item_index);
 
     /*
         heapifies the array in a top-down approach
         @param item_index, index of item to check with children to see if heap conditions are satisfied
     */
-    void removeHeapify(const ItemType &item_index);
+    void removeHeapify(size_t item_index);
+
+    /*
+        builds a heap from the items in the array by heapifying every node starting from the deepest non-leaf node
+    */
+    void buildHeap();
+
+    /*
+        moves every item into a new array of the specified capacity
+        @param new_capacity, number of items the new array can hold
+    */
+    void reallocate(size_t new_capacity);
+
+    /*
+        checks if the array has no room left for another item
+        @return true if the next insert has to grow the array, and false otherwise
+    */
+    bool atCapacity() const;
 };
 
 #include "Heap.cpp"
@@ -39,7 +39,7 @@ void heapify(int arr[], int size, int root_index)
         arr[greater_child_index] = temp;
 
         //recursively call the function to continue heapifying
-        heapify(arr, greater_child_index, size);
+        heapify(arr, size, greater_child_index);
     }
 }
 
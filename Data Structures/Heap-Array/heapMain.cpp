@@ -6,6 +6,8 @@ Date Created: 6/21/2021
 */
 
 #include <iostream>
+#include <string>
+#include <vector>
 #include "Heap.hpp"
 
 using namespace std;
@@ -32,6 +34,7 @@ int main()
     myHeap.display();
     cout << endl<< "Peek: ";
     myHeap.peek();
+    cout << endl << "Top: " << myHeap.top();
     cout << endl << "Empty?: " << myHeap.isEmpty() << endl;
     cout << "Full?: " << myHeap.isFull() << endl;
     cout << "Height: " << myHeap.getHeight() << endl << endl;
@@ -46,5 +49,43 @@ int main()
     myHeap.peek();
     cout << endl << "Empty? (After Clear): " << myHeap.isEmpty() << endl;
     cout << "Full? (After Clear): " << myHeap.isFull() << endl;
-    cout << "Height: " << myHeap.getHeight() << endl;
+    cout << "Height: " << myHeap.getHeight() << endl << endl;
+
+    /*
+        build heap test; heapifies a whole array at once instead of inserting its items one at a time
+    */
+    vector<int> myItems = {2, 4, 15, 6, 18, 12, 10, 9, 8, 23, 27};
+    Heap<int> myBuiltHeap(myItems.begin(), myItems.end());
+
+    cout << "Display (Build Heap): ";
+    myBuiltHeap.display();
+    cout << endl << "Item Count (Build Heap): " << myBuiltHeap.itemCount() << endl << endl;
+
+    /*
+        growth test; the heap grows past its first array, and reserve presizes it for a bulk load
+    */
+    myHeap.reserve(1000);
+
+    for(int i = 0; i < 1000; i++)
+    {
+        myHeap.insert(i);
+    }
+
+    cout << "Peek (After 1000 Inserts): ";
+    myHeap.peek();
+    cout << endl << "Height (After 1000 Inserts): " << myHeap.getHeight() << endl << endl;
+
+    /*
+        move test; inserted strings are moved into the heap rather than copied
+    */
+    Heap<string> myStringHeap;
+    string name = "Shelly";
+
+    myStringHeap.insert("Penny");
+    myStringHeap.insert(std::move(name));
+    myStringHeap.insert("Colt");
+
+    cout << "Peek (string): ";
+    myStringHeap.peek();
+    cout << endl;
 }
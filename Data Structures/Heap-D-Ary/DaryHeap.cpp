@@ -0,0 +1,239 @@
+/*
+Title: D-ary Heap (cache-aligned array heap)
+Author: Edwin Khew
+Description: D-ary heap class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <new> //for placement new and aligned allocation
+#include <stdexcept> //for std::out_of_range
+#include <utility> //for std::move
+
+template<typename ItemType, size_t D, typename Compare>
+DaryHeap<ItemType, D, Compare>::DaryHeap():heap_(nullptr), buffer_(nullptr), item_count_(0), capacity_(0) { }
+
+template<typename ItemType, size_t D, typename Compare>
+DaryHeap<ItemType, D, Compare>::~DaryHeap()
+{
+    clear();
+
+    ::operator delete(buffer_, std::align_val_t(CACHE_LINE_SIZE_));
+    heap_ = nullptr;
+    buffer_ = nullptr;
+}
+
+template<typename ItemType, size_t D, typename Compare>
+void DaryHeap<ItemType, D, Compare>::insert(const ItemType &new_item)
+{
+    insert(ItemType(new_item));
+}
+
+template<typename ItemType, size_t D, typename Compare>
+void DaryHeap<ItemType, D, Compare>::insert(ItemType &&new_item)
+{
+    if(item_count_ == capacity_) //grow geometrically, so that inserting is O(1) amortized on top of the sift
+    {
+        reallocate(capacity_ > 0 ? 2 * capacity_ : MIN_CAPACITY_);
+    }
+
+    new (&heap_[item_count_]) ItemType(std::move(new_item)); //insert the new item to the end of the array
+    item_count_++;
+
+    siftUp(item_count_ - 1); //heapify the array
+}
+
+template<typename ItemType, size_t D, typename Compare>
+void DaryHeap<ItemType, D, Compare>::remove()
+{
+    if(!isEmpty()) //can only remove if the heap is not empty
+    {
+        item_count_--;
+
+        if(item_count_ > 0)
+        {
+            heap_[0] = std::move(heap_[item_count_]); //replace the item at the root with the item at the end of the array
+        }
+
+        heap_[item_count_].~ItemType();
+
+        siftDown(0); //heapify the array
+    }
+}
+
+template<typename ItemType, size_t D, typename Compare>
+const ItemType &DaryHeap<ItemType, D, Compare>::top() const
+{
+    if(isEmpty())
+    {
+        throw(std::out_of_range("Heap is empty!"));
+    }
+
+    return heap_[0];
+}
+
+template<typename ItemType, size_t D, typename Compare>
+void DaryHeap<ItemType, D, Compare>::clear()
+{
+    for(size_t i = 0; i < item_count_; i++)
+    {
+        heap_[i].~ItemType();
+    }
+
+    item_count_ = 0;
+}
+
+template<typename ItemType, size_t D, typename Compare>
+void DaryHeap<ItemType, D, Compare>::reserve(size_t count)
+{
+    if(count > capacity_)
+    {
+        reallocate(count);
+    }
+}
+
+template<typename ItemType, size_t D, typename Compare>
+size_t DaryHeap<ItemType, D, Compare>::itemCount() const
+{
+    return item_count_;
+}
+
+template<typename ItemType, size_t D, typename Compare>
+int DaryHeap<ItemType, D, Compare>::getHeight() const
+{
+    int height = 0;
+    size_t level_size = 1; //number of nodes in the next level
+    size_t total = 0; //number of nodes in the levels counted so far
+
+    //count the levels needed to hold every item; each level holds 'D' times as many nodes as the one above it
+    while(total < item_count_)
+    {
+        total += level_size;
+        level_size *= D;
+        height++;
+    }
+
+    return height;
+}
+
+template<typename ItemType, size_t D, typename Compare>
+bool DaryHeap<ItemType, D, Compare>::isEmpty() const
+{
+    return item_count_ == 0;
+}
+
+template<typename ItemType, size_t D, typename Compare>
+void DaryHeap<ItemType, D, Compare>::peek() const
+{
+    if(!isEmpty()) //can only peek if the heap is not currently empty
+    {
+        std::cout << heap_[0];
+    }
+    else //if the heap is empty, print an error message
+    {
+        std::cout << "Heap is empty!";
+    }
+}
+
+template<typename ItemType, size_t D, typename Compare>
+void DaryHeap<ItemType, D, Compare>::display() const
+{
+    if(!isEmpty()) //can only display if the heap is not currently empty
+    {
+        for(size_t i = 0; i < item_count_; i++)
+        {
+            std::cout << heap_[i] << " ";
+        }
+    }
+    else //if the heap is empty, print an error message
+    {
+        std::cout << "Heap is empty!";
+    }
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+template<typename ItemType, size_t D, typename Compare>
+void DaryHeap<ItemType, D, Compare>::siftUp(size_t item_index)
+{
+    ItemType item = std::move(heap_[item_index]); //the item being moved up; its slot is now a hole
+
+    while(item_index > 0)
+    {
+        size_t parent_index = (item_index - 1) / D; //index of the item's parent
+
+        if(!compare_(heap_[parent_index], item)) //stop once the parent does not belong below the item
+        {
+            break;
+        }
+
+        heap_[item_index] = std::move(heap_[parent_index]); //move the parent down into the hole
+        item_index = parent_index;
+    }
+
+    heap_[item_index] = std::move(item);
+}
+
+template<typename ItemType, size_t D, typename Compare>
+void DaryHeap<ItemType, D, Compare>::siftDown(size_t item_index)
+{
+    if(item_count_ == 0)
+    {
+        return;
+    }
+
+    ItemType item = std::move(heap_[item_index]); //the item being moved down; its slot is now a hole
+
+    while(true)
+    {
+        size_t first_child_index = D * item_index + 1; //index of the item's first child; its siblings follow it in the same cache line
+
+        if(first_child_index >= item_count_) //no children
+        {
+            break;
+        }
+
+        size_t last_child_index = (first_child_index + D < item_count_) ? first_child_index + D : item_count_; //one past the item's last child
+        size_t best_child_index = first_child_index; //index of the child that belongs highest
+
+        for(size_t i = first_child_index + 1; i < last_child_index; i++)
+        {
+            if(compare_(heap_[best_child_index], heap_[i]))
+            {
+                best_child_index = i;
+            }
+        }
+
+        if(!compare_(item, heap_[best_child_index])) //stop once no child belongs above the item
+        {
+            break;
+        }
+
+        heap_[item_index] = std::move(heap_[best_child_index]); //move the child up into the hole
+        item_index = best_child_index;
+    }
+
+    heap_[item_index] = std::move(item);
+}
+
+template<typename ItemType, size_t D, typename Compare>
+void DaryHeap<ItemType, D, Compare>::reallocate(size_t new_capacity)
+{
+    void *new_buffer = ::operator new((new_capacity + OFFSET_) * sizeof(ItemType), std::align_val_t(CACHE_LINE_SIZE_));
+    ItemType *new_heap = static_cast<ItemType *>(new_buffer) + OFFSET_;
+
+    //move every item into the new array, then destroy the moved-from items
+    for(size_t i = 0; i < item_count_; i++)
+    {
+        new (&new_heap[i]) ItemType(std::move(heap_[i]));
+        heap_[i].~ItemType();
+    }
+
+    ::operator delete(buffer_, std::align_val_t(CACHE_LINE_SIZE_));
+
+    buffer_ = new_buffer;
+    heap_ = new_heap;
+    capacity_ = new_capacity;
+}
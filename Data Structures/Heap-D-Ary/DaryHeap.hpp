@@ -0,0 +1,129 @@
+/*
+Title: D-ary Heap (cache-aligned array heap)
+Author: Edwin Khew
+Description: D-ary heap class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef DARY_HEAP_H_
+#define DARY_HEAP_H_
+
+#include <cstddef>
+#include <functional> //for std::less
+
+/*
+    an array heap where every node has 'D' children instead of 2; the heap is only about half (D = 4) or a third (D = 8) as tall as a binary heap, so removing the root touches far fewer levels, and each level's children are compared within a single cache line
+    the array is laid out so that every group of siblings starts at a multiple of 'D' slots from a cache-line-aligned base; when 'D * sizeof(ItemType)' is 64 bytes (such as 8 'uint64_t's, or 4 16-byte items), each group fills exactly one cache line
+*/
+template <class ItemType, size_t D = 4, class Compare = std::less<ItemType>>
+class DaryHeap
+{
+public:
+    static_assert(D >= 2, "A heap node needs at least 2 children!");
+
+    /*
+        default constructor
+    */
+    DaryHeap();
+
+    /*
+        destructor
+    */
+    ~DaryHeap();
+
+    DaryHeap(const DaryHeap &) = delete;
+    DaryHeap &operator=(const DaryHeap &) = delete;
+
+    /*
+        inserts a new item into the heap
+        @param new_item, item to insert into the heap
+    */
+    void insert(const ItemType &new_item);
+
+    /*
+        inserts a new item into the heap, moving it in instead of copying it
+        @param new_item, item to move into the heap
+    */
+    void insert(ItemType &&new_item);
+
+    /*
+        removes the item at the root of the heap
+    */
+    void remove();
+
+    /*
+        returns the item at the root of the heap; with the default comparator, this is the greatest item (use std::greater for a min-heap)
+        @return a reference to the root item; valid until the heap is next modified
+    */
+    const ItemType &top() const;
+
+    /*
+        removes every item from the heap; keeps the memory for reuse
+    */
+    void clear();
+
+    /*
+        makes room for the specified number of items, so that inserting them does not reallocate
+        @param count, number of items the heap should be able to hold
+    */
+    void reserve(size_t count);
+
+    /*
+        returns the number of items currently in the heap
+        @return an integer representing the number of items in the heap
+    */
+    size_t itemCount() const;
+
+    /*
+        returns the current height of the heap; counts the height in nodes
+        @return integer representing the height of the heap
+    */
+    int getHeight() const;
+
+    /*
+        checks if the heap is empty
+        @return true if the heap is empty, and false otherwise
+    */
+    bool isEmpty() const;
+
+    /*
+        prints the item at the root of the heap
+    */
+    void peek() const;
+
+    /*
+        prints the entire array heap
+    */
+    void display() const;
+private:
+    static const size_t CACHE_LINE_SIZE_ = 64; //alignment of the array
+    static const size_t OFFSET_ = D - 1; //number of unused slots before the root; shifts the children of node 'i' to slots 'D * (i + 1)' through 'D * (i + 1) + D - 1', so that every group of siblings starts at a multiple of 'D'
+    static const size_t MIN_CAPACITY_ = 16; //capacity of the first allocation
+
+    ItemType *heap_; //the array heap itself; 'heap_[i]' is logical node 'i', and its children are nodes 'D * i + 1' through 'D * i + D'
+    void *buffer_; //start of the cache-line-aligned allocation that 'heap_' points 'OFFSET_' slots into
+    size_t item_count_; //total number of items currently in the heap
+    size_t capacity_; //number of items the array can hold before it has to grow
+    Compare compare_; //comparison function object; 'compare_(a, b)' is true if 'a' belongs below 'b'
+
+    /*
+        moves an item up from the specified index until its parent is not below it; the item is moved into place once, and each parent it passes is moved down into the hole it leaves
+        @param item_index, index of the item to move up
+    */
+    void siftUp(size_t item_index);
+
+    /*
+        moves an item down from the specified index until none of its children belong above it
+        @param item_index, index of the item to move down
+    */
+    void siftDown(size_t item_index);
+
+    /*
+        moves every item into a new array of the specified capacity
+        @param new_capacity, number of items the new array can hold
+    */
+    void reallocate(size_t new_capacity);
+};
+
+#include "DaryHeap.cpp"
+#endif
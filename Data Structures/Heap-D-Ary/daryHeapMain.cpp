@@ -0,0 +1,90 @@
+/*
+Title: D-ary Heap (cache-aligned array heap)
+Author: Edwin Khew
+Description: D-ary heap class test file.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <cstdint>
+#include <functional> //for std::greater
+#include <string>
+#include "DaryHeap.hpp"
+
+using namespace std;
+
+int main()
+{
+    DaryHeap<int> myHeap; //4-ary max-heap
+    //DaryHeap<int, 8, greater<int>> myHeap; //arity and comparator test; an 8-ary min-heap
+
+    myHeap.insert(11);
+    myHeap.insert(10);
+    myHeap.insert(7);
+    myHeap.insert(9);
+    myHeap.insert(5);
+    myHeap.insert(6);
+    myHeap.insert(4);
+    myHeap.insert(8);
+    myHeap.insert(2);
+    myHeap.insert(3);
+    myHeap.insert(1);
+
+    //myHeap.remove();
+
+    cout << "Display: ";
+    myHeap.display();
+    cout << endl << "Peek: ";
+    myHeap.peek();
+    cout << endl << "Top: " << myHeap.top() << endl;
+    cout << "Empty?: " << myHeap.isEmpty() << endl;
+    cout << "Item Count: " << myHeap.itemCount() << endl;
+    cout << "Height: " << myHeap.getHeight() << endl;
+
+    cout << "Remove Order: ";
+
+    while(!myHeap.isEmpty())
+    {
+        cout << myHeap.top() << " ";
+        myHeap.remove();
+    }
+
+    cout << endl << endl;
+
+    /*
+        clear function test
+    */
+    myHeap.insert(1);
+    myHeap.clear();
+    cout << "Display (After Clear): ";
+    myHeap.display();
+    cout << endl << "Peek (After Clear): ";
+    myHeap.peek();
+    cout << endl << "Empty? (After Clear): " << myHeap.isEmpty() << endl;
+    cout << "Height (After Clear): " << myHeap.getHeight() << endl << endl;
+
+    /*
+        min-heap test; an 8-ary heap of 64-bit timestamps, so that every group of 8 siblings fills one cache line
+    */
+    DaryHeap<uint64_t, 8, greater<uint64_t>> myTimerHeap;
+    myTimerHeap.reserve(1000);
+
+    for(uint64_t i = 1000; i > 0; i--)
+    {
+        myTimerHeap.insert(i * 7 % 1000);
+    }
+
+    cout << "Top (Min-Heap): " << myTimerHeap.top() << endl;
+    cout << "Height (Min-Heap): " << myTimerHeap.getHeight() << endl << endl;
+
+    /*
+        string test; items are moved rather than copied as the heap grows and sifts
+    */
+    DaryHeap<string> myStringHeap;
+
+    myStringHeap.insert("Penny");
+    myStringHeap.insert("Shelly");
+    myStringHeap.insert("Colt");
+
+    cout << "Top (string): " << myStringHeap.top() << endl;
+}
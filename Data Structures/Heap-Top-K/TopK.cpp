@@ -0,0 +1,210 @@
+/*
+Title: Top-K Heap (bounded heap)
+Author: Edwin Khew
+Description: Top-K heap class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <stdexcept> //for std::out_of_range
+#include <utility> //for std::move and std::swap
+
+template<typename ItemType, size_t K, typename Compare>
+TopK<ItemType, K, Compare>::TopK():item_count_(0) { }
+
+template<typename ItemType, size_t K, typename Compare>
+bool TopK<ItemType, K, Compare>::push(const ItemType &new_item)
+{
+    if(item_count_ < K) //not full yet; keep every item
+    {
+        heap_[item_count_] = new_item;
+        item_count_++;
+
+        siftUp(item_count_ - 1);
+
+        return true;
+    }
+
+    if(!compare_(heap_[0], new_item)) //the item does not beat the threshold; ties keep the earlier item
+    {
+        return false;
+    }
+
+    heap_[0] = new_item; //replace the threshold, and let the new item sink to its place
+    siftDown(0, K);
+
+    return true;
+}
+
+template<typename ItemType, size_t K, typename Compare>
+size_t TopK<ItemType, K, Compare>::pushBatch(const ItemType *items, size_t count)
+{
+    size_t kept = 0;
+    size_t i = 0;
+
+    //fill the heap first
+    while(i < count && item_count_ < K)
+    {
+        push(items[i]);
+        kept++;
+        i++;
+    }
+
+    if(i == count)
+    {
+        return kept;
+    }
+
+    ItemType threshold = heap_[0]; //a copy of the threshold; the compiler can keep it in a register instead of reloading it through the heap after every item
+
+    for(; i < count; i++)
+    {
+        if(compare_(threshold, items[i])) //rare for a long stream; the chance of beating the threshold falls as 'K' divided by the number of items seen
+        {
+            heap_[0] = items[i];
+            siftDown(0, K);
+
+            threshold = heap_[0];
+            kept++;
+        }
+    }
+
+    return kept;
+}
+
+template<typename ItemType, size_t K, typename Compare>
+const ItemType &TopK<ItemType, K, Compare>::threshold() const
+{
+    if(isEmpty())
+    {
+        throw(std::out_of_range("Heap is empty!"));
+    }
+
+    return heap_[0];
+}
+
+template<typename ItemType, size_t K, typename Compare>
+size_t TopK<ItemType, K, Compare>::extractSorted(ItemType *output)
+{
+    size_t count = item_count_;
+
+    //heapsort; the worst remaining item is moved to the end of the heap each time, so the array ends up best item first
+    for(size_t i = count; i > 1; i--)
+    {
+        std::swap(heap_[0], heap_[i - 1]);
+        siftDown(0, i - 1);
+    }
+
+    for(size_t i = 0; i < count; i++)
+    {
+        output[i] = std::move(heap_[i]);
+    }
+
+    item_count_ = 0;
+
+    return count;
+}
+
+template<typename ItemType, size_t K, typename Compare>
+void TopK<ItemType, K, Compare>::clear()
+{
+    item_count_ = 0;
+}
+
+template<typename ItemType, size_t K, typename Compare>
+size_t TopK<ItemType, K, Compare>::itemCount() const
+{
+    return item_count_;
+}
+
+template<typename ItemType, size_t K, typename Compare>
+bool TopK<ItemType, K, Compare>::isEmpty() const
+{
+    return item_count_ == 0;
+}
+
+template<typename ItemType, size_t K, typename Compare>
+bool TopK<ItemType, K, Compare>::isFull() const
+{
+    return item_count_ == K;
+}
+
+template<typename ItemType, size_t K, typename Compare>
+void TopK<ItemType, K, Compare>::peek() const
+{
+    if(!isEmpty()) //can only peek if the heap is not currently empty
+    {
+        std::cout << heap_[0];
+    }
+    else //if the heap is empty, print an error message
+    {
+        std::cout << "Heap is empty!";
+    }
+}
+
+template<typename ItemType, size_t K, typename Compare>
+void TopK<ItemType, K, Compare>::display() const
+{
+    if(!isEmpty()) //can only display if the heap is not currently empty
+    {
+        for(size_t i = 0; i < item_count_; i++)
+        {
+            std::cout << heap_[i] << " ";
+        }
+    }
+    else //if the heap is empty, print an error message
+    {
+        std::cout << "Heap is empty!";
+    }
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+template<typename ItemType, size_t K, typename Compare>
+void TopK<ItemType, K, Compare>::siftUp(size_t item_index)
+{
+    ItemType item = std::move(heap_[item_index]); //the item being moved up; its slot is now a hole
+
+    while(item_index > 0)
+    {
+        size_t parent_index = (item_index - 1) / 2;
+
+        if(!compare_(item, heap_[parent_index])) //stop once the item is not worse than its parent
+        {
+            break;
+        }
+
+        heap_[item_index] = std::move(heap_[parent_index]); //move the parent down into the hole
+        item_index = parent_index;
+    }
+
+    heap_[item_index] = std::move(item);
+}
+
+template<typename ItemType, size_t K, typename Compare>
+void TopK<ItemType, K, Compare>::siftDown(size_t item_index, size_t count)
+{
+    ItemType item = std::move(heap_[item_index]); //the item being moved down; its slot is now a hole
+
+    while(2 * item_index + 1 < count)
+    {
+        size_t child_index = 2 * item_index + 1; //left child
+
+        if(child_index + 1 < count && compare_(heap_[child_index + 1], heap_[child_index])) //pick the worse child
+        {
+            child_index++;
+        }
+
+        if(!compare_(heap_[child_index], item)) //stop once neither child is worse than the item
+        {
+            break;
+        }
+
+        heap_[item_index] = std::move(heap_[child_index]); //move the child up into the hole
+        item_index = child_index;
+    }
+
+    heap_[item_index] = std::move(item);
+}
@@ -0,0 +1,109 @@
+/*
+Title: Top-K Heap (bounded heap)
+Author: Edwin Khew
+Description: Top-K heap class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef TOP_K_H_
+#define TOP_K_H_
+
+#include <cstddef>
+#include <functional> //for std::less
+
+/*
+    keeps the 'K' greatest items of a stream of any length (use std::greater to keep the 'K' smallest instead), in a fixed array of 'K' items; memory never grows with the stream
+    the array is a heap with the worst of the kept items at its root; that item is the threshold a new item has to beat, so once the heap is full, almost every item of a long stream is turned away with a single comparison
+*/
+template <class ItemType, size_t K, class Compare = std::less<ItemType>>
+class TopK
+{
+public:
+    static_assert(K > 0, "A top-K heap has to keep at least 1 item!");
+
+    /*
+        default constructor
+    */
+    TopK();
+
+    /*
+        offers an item to the heap; while the heap is not full every item is kept, and after that an item is only kept if it beats the threshold, replacing it
+        @param new_item, item to offer
+        @return true if the item was kept, and false otherwise
+    */
+    bool push(const ItemType &new_item);
+
+    /*
+        offers a batch of items to the heap; the threshold is kept in a local variable and only reloaded when an item is kept, so the loop over rejected items is a compare and a branch
+        @param items, pointer to the first of the items to offer
+        @param count, number of items to offer
+        @return the number of items that were kept; some of them may have been pushed out again by later items of the batch
+    */
+    size_t pushBatch(const ItemType *items, size_t count);
+
+    /*
+        returns the threshold; the worst of the kept items
+        @return a reference to the item at the root of the heap; valid until the heap is next modified
+    */
+    const ItemType &threshold() const;
+
+    /*
+        copies the kept items into an array, best item first, and empties the heap; the items are sorted in place with heapsort first, so no extra memory is needed
+        @param output, array of at least 'itemCount()' items
+        @return the number of items copied
+    */
+    size_t extractSorted(ItemType *output);
+
+    /*
+        removes every item from the heap
+    */
+    void clear();
+
+    /*
+        returns the number of items currently kept
+        @return an integer representing the number of items in the heap; at most 'K'
+    */
+    size_t itemCount() const;
+
+    /*
+        checks if the heap is empty
+        @return true if the heap is empty, and false otherwise
+    */
+    bool isEmpty() const;
+
+    /*
+        checks if the heap is full; from then on, every new item has to beat the threshold to be kept
+        @return true if the heap holds 'K' items, and false otherwise
+    */
+    bool isFull() const;
+
+    /*
+        prints the threshold
+    */
+    void peek() const;
+
+    /*
+        prints the entire array heap
+    */
+    void display() const;
+private:
+    ItemType heap_[K]; //the array heap itself; the worst kept item is at index 0
+    size_t item_count_; //total number of items currently in the heap
+    Compare compare_; //comparison function object; 'compare_(a, b)' is true if 'a' is worse than 'b'
+
+    /*
+        moves an item up from the specified index until its parent is not better than it
+        @param item_index, index of the item to move up
+    */
+    void siftUp(size_t item_index);
+
+    /*
+        moves an item down from the specified index until neither of its children is worse than it
+        @param item_index, index of the item to move down
+        @param count, number of items of the array that belong to the heap
+    */
+    void siftDown(size_t item_index, size_t count);
+};
+
+#include "TopK.cpp"
+#endif
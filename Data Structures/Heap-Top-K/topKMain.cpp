@@ -0,0 +1,109 @@
+/*
+Title: Top-K Heap (bounded heap)
+Author: Edwin Khew
+Description: Top-K heap class test file.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <cstdint>
+#include <functional> //for std::greater
+#include <string>
+#include <vector>
+#include "TopK.hpp"
+
+using namespace std;
+
+int main()
+{
+    TopK<int, 5> myTopK; //keeps the 5 greatest items
+    //TopK<int, 5, greater<int>> myTopK; //comparator test; keeps the 5 smallest items
+
+    myTopK.push(11);
+    myTopK.push(10);
+    myTopK.push(7);
+    myTopK.push(9);
+    myTopK.push(5);
+    myTopK.push(6);
+    myTopK.push(4);
+    myTopK.push(8);
+    myTopK.push(2);
+    myTopK.push(3);
+    myTopK.push(1);
+
+    cout << "Display: ";
+    myTopK.display();
+    cout << endl << "Peek: ";
+    myTopK.peek();
+    cout << endl << "Threshold: " << myTopK.threshold() << endl;
+    cout << "Empty?: " << myTopK.isEmpty() << endl;
+    cout << "Full?: " << myTopK.isFull() << endl;
+    cout << "Item Count: " << myTopK.itemCount() << endl;
+
+    int best[5];
+    size_t count = myTopK.extractSorted(best);
+
+    cout << "Sorted: ";
+
+    for(size_t i = 0; i < count; i++)
+    {
+        cout << best[i] << " ";
+    }
+
+    cout << endl << "Empty? (After Extract): " << myTopK.isEmpty() << endl << endl;
+
+    /*
+        streaming test; the 10 smallest of 1,000,000 scores, offered in batches of 4096 so that the whole stream never has to be held at once
+    */
+    TopK<uint64_t, 10, greater<uint64_t>> mySmallest;
+    vector<uint64_t> batch(4096);
+    uint64_t state = 1;
+    size_t kept = 0;
+
+    for(size_t offered = 0; offered < 1000000; offered += batch.size())
+    {
+        for(size_t i = 0; i < batch.size(); i++) //fill the batch with pseudo-random scores
+        {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            batch[i] = state >> 33;
+        }
+
+        kept += mySmallest.pushBatch(batch.data(), batch.size());
+    }
+
+    uint64_t smallest[10];
+    count = mySmallest.extractSorted(smallest);
+
+    cout << "Kept (Stream): " << kept << " of 1000000" << endl;
+    cout << "Smallest (Stream): ";
+
+    for(size_t i = 0; i < count; i++)
+    {
+        cout << smallest[i] << " ";
+    }
+
+    cout << endl << endl;
+
+    /*
+        string test
+    */
+    TopK<string, 3> myStringTopK;
+
+    myStringTopK.push("Penny");
+    myStringTopK.push("Shelly");
+    myStringTopK.push("Colt");
+    myStringTopK.push("Spike");
+    myStringTopK.push("Brock");
+
+    string names[3];
+    count = myStringTopK.extractSorted(names);
+
+    cout << "Sorted (string): ";
+
+    for(size_t i = 0; i < count; i++)
+    {
+        cout << names[i] << " ";
+    }
+
+    cout << endl;
+}
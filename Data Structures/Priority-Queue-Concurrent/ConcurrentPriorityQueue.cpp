@@ -0,0 +1,210 @@
+/*
+Title: Concurrent Priority Queue (MultiQueue)
+Author: Edwin Khew
+Description: Concurrent priority queue class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <functional> //for std::hash
+#include <thread> //for std::this_thread
+#include <utility> //for std::move
+
+template<typename ItemType>
+ConcurrentPriorityQueue<ItemType>::ConcurrentPriorityQueue(size_t thread_count, bool strict):strict_(strict)
+{
+    queue_count_ = strict || thread_count == 0 ? 1 : QUEUES_PER_THREAD_ * thread_count;
+    queues_ = new SubQueue[queue_count_];
+}
+
+template<typename ItemType>
+ConcurrentPriorityQueue<ItemType>::~ConcurrentPriorityQueue()
+{
+    delete[] queues_;
+    queues_ = nullptr;
+}
+
+template<typename ItemType>
+bool ConcurrentPriorityQueue<ItemType>::enqueue(const ItemType &new_item, int priority)
+{
+    if(strict_)
+    {
+        SubQueue &queue = queues_[0];
+        std::lock_guard<std::mutex> guard(queue.lock_);
+
+        queue.heap_.insert(Entry{new_item, priority, queue.next_sequence_++});
+        updateCache(queue);
+
+        return true;
+    }
+
+    //any heap will do, so skip over the ones another thread is holding instead of waiting for them
+    while(true)
+    {
+        SubQueue &queue = queues_[randomQueue()];
+
+        if(queue.lock_.try_lock())
+        {
+            queue.heap_.insert(Entry{new_item, priority, queue.next_sequence_++});
+            updateCache(queue);
+            queue.lock_.unlock();
+
+            return true;
+        }
+    }
+}
+
+template<typename ItemType>
+bool ConcurrentPriorityQueue<ItemType>::dequeue(ItemType &item)
+{
+    if(strict_)
+    {
+        SubQueue &queue = queues_[0];
+        std::lock_guard<std::mutex> guard(queue.lock_);
+
+        if(queue.heap_.isEmpty())
+        {
+            return false;
+        }
+
+        removeTop(queue, item);
+
+        return true;
+    }
+
+    for(size_t i = 0; i < 2 * queue_count_; i++) //the two-choice dequeue; enough tries to find the few remaining items of an almost empty queue
+    {
+        if(tryDequeue(item))
+        {
+            return true;
+        }
+    }
+
+    //the random tries keep missing, so the queue is most likely empty; check every heap in turn before saying so
+    for(size_t i = 0; i < queue_count_; i++)
+    {
+        SubQueue &queue = queues_[i];
+
+        if(queue.item_count_.load(std::memory_order_relaxed) == 0)
+        {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> guard(queue.lock_);
+
+        if(!queue.heap_.isEmpty())
+        {
+            removeTop(queue, item);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template<typename ItemType>
+size_t ConcurrentPriorityQueue<ItemType>::size() const
+{
+    size_t count = 0;
+
+    for(size_t i = 0; i < queue_count_; i++)
+    {
+        count += queues_[i].item_count_.load(std::memory_order_relaxed);
+    }
+
+    return count;
+}
+
+template<typename ItemType>
+bool ConcurrentPriorityQueue<ItemType>::isEmpty() const
+{
+    return size() == 0;
+}
+
+template<typename ItemType>
+bool ConcurrentPriorityQueue<ItemType>::isStrict() const
+{
+    return strict_;
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+template<typename ItemType>
+bool ConcurrentPriorityQueue<ItemType>::tryDequeue(ItemType &item)
+{
+    SubQueue *first = &queues_[randomQueue()];
+    SubQueue *second = &queues_[randomQueue()];
+
+    //the cached priorities may be slightly stale, which only costs some accuracy; the heap itself is checked again under its lock
+    //an empty heap is told apart by its item count, since its cached priority is also a valid priority for an item
+    if(first->item_count_.load(std::memory_order_relaxed) == 0 || (second->item_count_.load(std::memory_order_relaxed) != 0 && second->top_priority_.load(std::memory_order_relaxed) < first->top_priority_.load(std::memory_order_relaxed)))
+    {
+        first = second;
+    }
+
+    if(first->item_count_.load(std::memory_order_relaxed) == 0 || !first->lock_.try_lock())
+    {
+        return false;
+    }
+
+    bool removed = !first->heap_.isEmpty();
+
+    if(removed)
+    {
+        removeTop(*first, item);
+    }
+
+    first->lock_.unlock();
+
+    return removed;
+}
+
+template<typename ItemType>
+void ConcurrentPriorityQueue<ItemType>::removeTop(SubQueue &queue, ItemType &item)
+{
+    item = queue.heap_.top().item_;
+    queue.heap_.remove();
+
+    updateCache(queue);
+}
+
+template<typename ItemType>
+void ConcurrentPriorityQueue<ItemType>::updateCache(SubQueue &queue)
+{
+    int top_priority = EMPTY_PRIORITY_;
+
+    if(!queue.heap_.isEmpty())
+    {
+        top_priority = queue.heap_.top().priority_;
+    }
+
+    queue.top_priority_.store(top_priority, std::memory_order_relaxed);
+    queue.item_count_.store(queue.heap_.itemCount(), std::memory_order_relaxed);
+}
+
+template<typename ItemType>
+size_t ConcurrentPriorityQueue<ItemType>::randomQueue() const
+{
+    thread_local uint64_t state = std::hash<std::thread::id>()(std::this_thread::get_id()); //seeded differently on every thread
+
+    //splitmix64; a single add and a few multiplies, and every seed gives a full-period sequence
+    state += 0x9E3779B97F4A7C15ULL;
+    uint64_t random = state;
+    random = (random ^ (random >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    random = (random ^ (random >> 27)) * 0x94D049BB133111EBULL;
+    random ^= random >> 31;
+
+    return static_cast<size_t>(((random >> 32) * queue_count_) >> 32); //maps the high 32 bits onto [0, queue_count_) without a division
+}
+
+template<typename ItemType>
+bool ConcurrentPriorityQueue<ItemType>::Entry::operator>(const Entry &other) const
+{
+    if(priority_ != other.priority_)
+    {
+        return priority_ < other.priority_; //lower priority values leave first
+    }
+
+    return sequence_ < other.sequence_; //among equal priorities, the earlier insert leaves first
+}
@@ -0,0 +1,137 @@
+/*
+Title: Concurrent Priority Queue (MultiQueue)
+Author: Edwin Khew
+Description: Concurrent priority queue class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef CONCURRENT_PRIORITY_QUEUE_H_
+#define CONCURRENT_PRIORITY_QUEUE_H_
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <mutex>
+
+/*
+    a priority queue that many threads can enqueue into and dequeue from at once
+    in the default relaxed mode, the items are spread over several heaps, each behind its own lock; an enqueue locks any one heap that is free, and a dequeue looks at the front of two random heaps and takes from the better one. Threads rarely wait on each other, but an item may leave slightly before some items with lower priority values (on average only a few places out of order)
+    in strict mode, there is a single heap behind a single lock, and items leave in exactly the order a 'PriorityQueue' would give
+*/
+template <class ItemType>
+class ConcurrentPriorityQueue
+{
+public:
+    /*
+        constructor
+        @param thread_count, number of threads expected to use the queue; the relaxed mode keeps 'QUEUES_PER_THREAD_' heaps per thread
+        @param strict, whether items have to leave in exact priority order; if true, there is only one heap, and every operation takes its lock
+    */
+    ConcurrentPriorityQueue(size_t thread_count, bool strict = false);
+
+    /*
+        destructor
+    */
+    ~ConcurrentPriorityQueue();
+
+    ConcurrentPriorityQueue(const ConcurrentPriorityQueue &) = delete;
+    ConcurrentPriorityQueue &operator=(const ConcurrentPriorityQueue &) = delete;
+
+    /*
+        inserts a new item into the queue, based on its priority; items with lower priority values leave the queue first
+        @param new_item, item to be inserted
+        @param priority, priority of the item
+        @return true if the item was successfully inserted, and false otherwise
+    */
+    bool enqueue(const ItemType &new_item, int priority);
+
+    /*
+        removes an item at or near the front of the queue; in strict mode, always the item with the lowest priority value
+        @param item, set to the removed item
+        @return true if an item was removed, and false if the queue was empty
+    */
+    bool dequeue(ItemType &item);
+
+    /*
+        returns the number of items in the queue; only exact when no other thread is changing the queue
+        @return the number of items in the queue
+    */
+    size_t size() const;
+
+    /*
+        checks if the queue is empty; only exact when no other thread is changing the queue
+        @return true if the queue is empty, and false otherwise
+    */
+    bool isEmpty() const;
+
+    /*
+        checks if the queue hands out items in exact priority order
+        @return true if the queue is in strict mode, and false if it is relaxed
+    */
+    bool isStrict() const;
+private:
+    static const size_t QUEUES_PER_THREAD_ = 2; //heaps per thread in the relaxed mode; with twice as many heaps as threads, a free heap is almost always found on the first try
+    static const int EMPTY_PRIORITY_ = INT_MAX; //cached front priority of an empty heap; items may have this priority too, so whether a heap is empty is read from its item count
+
+    /*
+        an item of the queue along with the order it leaves in
+    */
+    struct Entry
+    {
+        ItemType item_; //the item itself
+        int priority_; //priority of the item
+        uint64_t sequence_; //number of items inserted into the same heap before this one; breaks ties between equal priorities
+
+        /*
+            checks if this entry leaves the queue before another one; the heap keeps the "greatest" entry at its root
+            @param other, entry to compare with
+            @return true if this entry has a lower priority value, or the same priority value and was inserted earlier
+        */
+        bool operator>(const Entry &other) const;
+    };
+
+    /*
+        one of the heaps along with its lock; aligned to a cache line so that threads working on neighbouring heaps never write to the same line
+    */
+    struct alignas(64) SubQueue
+    {
+        std::mutex lock_; //guards 'heap_' and 'next_sequence_'
+        Heap<Entry> heap_; //binary heap of the entries; the entry at the root leaves first
+        uint64_t next_sequence_ = 0; //sequence number of the next item inserted into this heap
+        std::atomic<int> top_priority_{EMPTY_PRIORITY_}; //priority of the entry at the root, or 'EMPTY_PRIORITY_'; read without the lock to pick which heap to dequeue from
+        std::atomic<size_t> item_count_{0}; //number of entries in the heap; read without the lock by 'size'
+    };
+
+    SubQueue *queues_; //array of heaps
+    size_t queue_count_; //number of heaps; 1 in strict mode
+    bool strict_; //whether there is a single heap that every operation locks
+
+    /*
+        dequeues from two random heaps, whichever has the lower priority at its front
+        @param item, set to the removed item
+        @return true if an item was removed, and false if the chosen heap was locked or empty
+    */
+    bool tryDequeue(ItemType &item);
+
+    /*
+        removes the entry at the root of a heap; the heap's lock must be held
+        @param queue, the heap to remove from
+        @param item, set to the removed item
+    */
+    void removeTop(SubQueue &queue, ItemType &item);
+
+    /*
+        refreshes the cached front priority and item count of a heap; the heap's lock must be held
+        @param queue, the heap that changed
+    */
+    void updateCache(SubQueue &queue);
+
+    /*
+        picks a heap at random; each thread has its own random number generator, so picking never touches shared memory
+        @return the index of a heap
+    */
+    size_t randomQueue() const;
+};
+
+#include "ConcurrentPriorityQueue.cpp"
+#endif
@@ -0,0 +1,300 @@
+/*
+Title: Array Heap
+Author: Edwin Khew
+Description: Array heap class implementation.
+Date Created: 6/21/2021
+*/
+
+#include <iterator> //for std::distance and std::iterator_traits
+#include <math.h> //for finding height of heap
+#include <new> //for placement new
+#include <stdexcept> //for std::out_of_range
+#include <type_traits> //for std::is_base_of
+#include <utility> //for std::move and std::swap
+
+template<typename ItemType>
+Heap<ItemType>::Heap():heap_(nullptr), item_count_(0), capacity_(0) { }
+
+template<typename ItemType>
+template<typename InputIterator>
+Heap<ItemType>::Heap(InputIterator first, InputIterator last):heap_(nullptr), item_count_(0), capacity_(0)
+{
+    //when the range can be measured up front, allocate the array once
+    if(std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>::value)
+    {
+        reserve(std::distance(first, last));
+    }
+
+    //copy every item to the end of the array without heapifying
+    for(; first != last; ++first)
+    {
+        if(item_count_ == capacity_)
+        {
+            reallocate(capacity_ > 0 ? 2 * capacity_ : MIN_CAPACITY_);
+        }
+
+        new (&heap_[item_count_]) ItemType(*first);
+        item_count_++;
+    }
+
+    buildHeap(); //then heapify the whole array at once
+}
+
+template<typename ItemType>
+Heap<ItemType>::Heap(const Heap &heap):heap_(nullptr), item_count_(0), capacity_(0)
+{
+    reserve(heap.item_count_);
+
+    //copy every item; the original array is already a heap, so no heapifying is needed
+    for(size_t i = 0; i < heap.item_count_; i++)
+    {
+        new (&heap_[i]) ItemType(heap.heap_[i]);
+        item_count_++;
+    }
+}
+
+template<typename ItemType>
+Heap<ItemType>::~Heap()
+{
+    clear();
+
+    ::operator delete(heap_);
+    heap_ = nullptr;
+}
+
+template<typename ItemType>
+void Heap<ItemType>::insert(const ItemType &new_item)
+{
+    insert(ItemType(new_item));
+}
+
+template<typename ItemType>
+void Heap<ItemType>::insert(ItemType &&new_item)
+{
+    if(atCapacity()) //grow geometrically, so that inserting is O(1) amortized on top of the heapify
+    {
+        reallocate(capacity_ > 0 ? 2 * capacity_ : MIN_CAPACITY_);
+    }
+
+    new (&heap_[item_count_]) ItemType(std::move(new_item)); //insert the new item to the end of the array
+    item_count_++;
+
+    insertHeapify(item_count_ - 1); //heapify the array
+}
+
+template<typename ItemType>
+void Heap<ItemType>::insertHeapify(size_t item_index)
+{
+    if(item_index == 0) //the root has no parent
+    {
+        return;
+    }
+
+    size_t parent_index = (item_index - 1) / 2; //index of the item's parent
+
+    if(heap_[item_index] > heap_[parent_index]) //swap if the child is greater (or less than for min-heap) than its parent; use '>' for max-heap and '<' for min-heap
+    {
+        std::swap(heap_[item_index], heap_[parent_index]); //swap; moves the items instead of copying them
+
+        //recursively call the function to continue heapifying
+        insertHeapify(parent_index);
+    }
+}
+
+template<typename ItemType>
+void Heap<ItemType>::remove()
+{
+    if(!isEmpty()) //can only remove if the heap is not empty
+    {
+        item_count_--;
+
+        if(item_count_ > 0)
+        {
+            heap_[0] = std::move(heap_[item_count_]); //replace the item at the root with the item at the end of the array
+        }
+
+        heap_[item_count_].~ItemType();
+
+        removeHeapify(0); //heapify the array
+    }
+}
+
+//max-heap heapify
+template<typename ItemType>
+void Heap<ItemType>::removeHeapify(size_t item_index)
+{
+    size_t left_child_index = (2 * item_index) + 1; //index of the item's left child
+    size_t right_child_index = (2 * item_index) + 2; //index of the item's right child
+    size_t greater_child_index = item_index; //index of the child that is greater; if no children are present, then the index will be that of the root
+
+    //if the index of 'left_child' exists and its item is greater than that of the current greater child
+    if((left_child_index < item_count_) && (heap_[left_child_index] > heap_[greater_child_index]))
+    {
+        greater_child_index = left_child_index;
+    }
+
+    //if the index of 'right_child' exists and its item is greater than that of the current greater child
+    if((right_child_index < item_count_) && (heap_[right_child_index] > heap_[greater_child_index]))
+    {
+        greater_child_index = right_child_index;
+    }
+
+    if(greater_child_index != item_index) //can only swap if a child is present
+    {
+        std::swap(heap_[item_index], heap_[greater_child_index]); //swap; moves the items instead of copying them
+
+        //recursively call the function to continue heapifying
+        removeHeapify(greater_child_index);
+    }
+}
+
+/*
+
+//min-heap heapify
+template<typename ItemType>
+void Heap<ItemType>::removeHeapify(size_t item_index)
+{
+    size_t left_child_index = (2 * item_index) + 1; //index of the item's left child
+    size_t right_child_index = (2 * item_index) + 2; //index of the item's right child
+    size_t lesser_child_index = item_index; //index of the child that is lesser; if no children are present, then the index will be that of the root
+
+    //if the index of 'left_child' exists and its item is less than that of the current lesser child
+    if((left_child_index < item_count_) && (heap_[left_child_index] < heap_[lesser_child_index]))
+    {
+        lesser_child_index = left_child_index;
+    }
+
+    //if the index of 'right_child' exists and its item is less than that of the current lesser child
+    if((right_child_index < item_count_) && (heap_[right_child_index] < heap_[lesser_child_index]))
+    {
+        lesser_child_index = right_child_index;
+    }
+
+    if(lesser_child_index != item_index) //can only swap if a child is present
+    {
+        std::swap(heap_[item_index], heap_[lesser_child_index]); //swap; moves the items instead of copying them
+
+        //recursively call the function to continue heapifying
+        removeHeapify(lesser_child_index);
+    }
+}
+
+*/
+
+template<typename ItemType>
+void Heap<ItemType>::clear()
+{
+    for(size_t i = 0; i < item_count_; i++)
+    {
+        heap_[i].~ItemType();
+    }
+
+    item_count_ = 0;
+}
+
+template<typename ItemType>
+void Heap<ItemType>::reserve(size_t count)
+{
+    if(count > capacity_)
+    {
+        reallocate(count);
+    }
+}
+
+template<typename ItemType>
+size_t Heap<ItemType>::itemCount() const
+{
+    return item_count_;
+}
+
+template<typename ItemType>
+int Heap<ItemType>::getHeight() const
+{
+    return ceil(log2(item_count_ + 1));
+}
+
+template<typename ItemType>
+bool Heap<ItemType>::isEmpty() const
+{
+    return item_count_ == 0;
+}
+
+template<typename ItemType>
+bool Heap<ItemType>::isFull() const
+{
+    return false;
+}
+
+template<typename ItemType>
+const ItemType &Heap<ItemType>::top() const
+{
+    if(isEmpty())
+    {
+        throw(std::out_of_range("Heap is empty!"));
+    }
+
+    return heap_[0];
+}
+
+template<typename ItemType>
+void Heap<ItemType>::peek() const
+{
+    if(!isEmpty()) //can only peek if the heap is not currently empty
+    {
+        std::cout << heap_[0];
+    }
+    else //if the heap is empty, print an error message
+    {
+        std::cout << "Heap is empty!";
+    }
+}
+
+template<typename ItemType>
+void Heap<ItemType>::display() const
+{
+    if(!isEmpty()) //can only display if the heap is not currently empty
+    {
+        for(size_t i = 0; i < item_count_; i++)
+        {
+            std::cout << heap_[i] << " ";
+        }
+    }
+    else //if the heap is empty, print an error message
+    {
+        std::cout << "Heap is empty!";
+    }
+}
+
+template<typename ItemType>
+void Heap<ItemType>::buildHeap()
+{
+    //start at the deepest non-leaf node, because leaves are already considered heapified; each node is heapified after its children, so the subtrees below it are already heaps
+    for(size_t i = item_count_ / 2; i > 0; i--) //backwards level order traversal; heapify each node
+    {
+        removeHeapify(i - 1);
+    }
+}
+
+template<typename ItemType>
+void Heap<ItemType>::reallocate(size_t new_capacity)
+{
+    ItemType *new_heap = static_cast<ItemType *>(::operator new(new_capacity * sizeof(ItemType))); //raw memory; items are only constructed as they are inserted
+
+    //move every item into the new array, then destroy the moved-from items
+    for(size_t i = 0; i < item_count_; i++)
+    {
+        new (&new_heap[i]) ItemType(std::move(heap_[i]));
+        heap_[i].~ItemType();
+    }
+
+    ::operator delete(heap_);
+
+    heap_ = new_heap;
+    capacity_ = new_capacity;
+}
+
+template<typename ItemType>
+bool Heap<ItemType>::atCapacity() const
+{
+    return item_count_ == capacity_;
+}
@@ -0,0 +1,128 @@
+/*
+Title: Concurrent Priority Queue (MultiQueue)
+Author: Edwin Khew
+Description: Concurrent priority queue test file.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Heap.hpp"
+#include "ConcurrentPriorityQueue.hpp"
+
+using namespace std;
+
+int main()
+{
+    ConcurrentPriorityQueue<string> myQueue(1, true); //strict mode; items leave in exact priority order
+    //ConcurrentPriorityQueue<string> myQueue(1); //relaxed mode test; with a single thread there are only 2 heaps, so the order is nearly exact
+
+    myQueue.enqueue("five", 5);
+    myQueue.enqueue("one", 1);
+    myQueue.enqueue("three", 3);
+    myQueue.enqueue("three-2", 3);
+    myQueue.enqueue("two", 2);
+    myQueue.enqueue("four", 4);
+    myQueue.enqueue("six", 6);
+    myQueue.enqueue("three-3", 3);
+
+    cout << "Strict?: " << myQueue.isStrict() << endl;
+    cout << "Empty?: " << myQueue.isEmpty() << endl;
+    cout << "Size: " << myQueue.size() << endl;
+
+    cout << "Dequeue Order: ";
+    string item;
+
+    while(myQueue.dequeue(item))
+    {
+        cout << item << " ";
+    }
+
+    cout << endl << endl;
+
+    /*
+        thread test; producers and consumers share a relaxed queue, and every item has to come out exactly once
+    */
+    const int THREAD_COUNT = 4;
+    const int ITEMS_PER_THREAD = 100000;
+
+    ConcurrentPriorityQueue<int> myRelaxedQueue(2 * THREAD_COUNT);
+    vector<thread> threads;
+    vector<char> seen(THREAD_COUNT * ITEMS_PER_THREAD, 0);
+    int dequeued[THREAD_COUNT] = {};
+
+    for(int t = 0; t < THREAD_COUNT; t++)
+    {
+        threads.push_back(thread([&myRelaxedQueue, t, ITEMS_PER_THREAD]() //producer
+        {
+            for(int i = t * ITEMS_PER_THREAD; i < (t + 1) * ITEMS_PER_THREAD; i++)
+            {
+                myRelaxedQueue.enqueue(i, i % 1000);
+            }
+        }));
+
+        threads.push_back(thread([&myRelaxedQueue, &seen, &dequeued, t, ITEMS_PER_THREAD]() //consumer
+        {
+            int item;
+
+            while(dequeued[t] < ITEMS_PER_THREAD) //each consumer takes as many items as one producer makes
+            {
+                if(myRelaxedQueue.dequeue(item))
+                {
+                    seen[item]++;
+                    dequeued[t]++;
+                }
+            }
+        }));
+    }
+
+    for(size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i].join();
+    }
+
+    int missing = 0;
+
+    for(size_t i = 0; i < seen.size(); i++)
+    {
+        if(seen[i] != 1)
+        {
+            missing++;
+        }
+    }
+
+    cout << "Items Missing or Duplicated (Threads): " << missing << endl;
+    cout << "Empty? (Threads): " << myRelaxedQueue.isEmpty() << endl << endl;
+
+    /*
+        relaxed order test; when a single thread dequeues, measures how far behind the true front each item is, in priority values
+    */
+    const int ORDER_ITEMS = 10000;
+
+    ConcurrentPriorityQueue<int> myOrderQueue(THREAD_COUNT);
+    vector<bool> removed(ORDER_ITEMS, false);
+
+    for(int i = 0; i < ORDER_ITEMS; i++)
+    {
+        myOrderQueue.enqueue(i * 7919 % ORDER_ITEMS, i * 7919 % ORDER_ITEMS); //every priority from 0 to 9999 once; the item is its own priority
+    }
+
+    long long total_distance = 0;
+    int front = 0; //lowest priority still in the queue
+    int priority;
+
+    while(myOrderQueue.dequeue(priority))
+    {
+        total_distance += priority - front;
+        removed[priority] = true;
+
+        while(front < ORDER_ITEMS && removed[front])
+        {
+            front++;
+        }
+    }
+
+    cout << "Average Distance From Front (Relaxed): " << static_cast<double>(total_distance) / ORDER_ITEMS << endl;
+}
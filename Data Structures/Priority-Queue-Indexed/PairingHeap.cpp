@@ -0,0 +1,282 @@
+/*
+Title: Pairing Heap
+Author: Edwin Khew
+Description: Pairing heap class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <stdexcept> //for std::out_of_range and std::invalid_argument
+#include <utility> //for std::swap
+
+template<typename ItemType, typename PriorityType>
+PairingHeap<ItemType, PriorityType>::PairingHeap():root_(nullptr), item_count_(0) { }
+
+template<typename ItemType, typename PriorityType>
+PairingHeap<ItemType, PriorityType>::~PairingHeap()
+{
+    clear();
+}
+
+template<typename ItemType, typename PriorityType>
+typename PairingHeap<ItemType, PriorityType>::Handle PairingHeap<ItemType, PriorityType>::push(const ItemType &new_item, PriorityType priority)
+{
+    Node *new_node = new Node{new_item, priority, nullptr, nullptr, nullptr};
+
+    root_ = root_ == nullptr ? new_node : link(root_, new_node);
+    item_count_++;
+
+    return new_node;
+}
+
+template<typename ItemType, typename PriorityType>
+bool PairingHeap<ItemType, PriorityType>::pop()
+{
+    if(isEmpty())
+    {
+        return false;
+    }
+
+    Node *old_root = root_;
+    root_ = mergePairs(old_root->child_); //the children of the old root are joined into the new heap
+
+    delete old_root;
+    item_count_--;
+
+    return true;
+}
+
+template<typename ItemType, typename PriorityType>
+void PairingHeap<ItemType, PriorityType>::decreaseKey(Handle handle, PriorityType new_priority)
+{
+    if(handle->priority_ < new_priority)
+    {
+        throw(std::invalid_argument("New priority is greater than the current priority!"));
+    }
+
+    handle->priority_ = new_priority;
+
+    if(handle != root_) //cut the node's subtree off and join it back at the root; the subtree is still heap-ordered, since only its root got smaller
+    {
+        cut(handle);
+        root_ = link(root_, handle);
+    }
+}
+
+template<typename ItemType, typename PriorityType>
+void PairingHeap<ItemType, PriorityType>::erase(Handle handle)
+{
+    if(handle == root_)
+    {
+        pop();
+        return;
+    }
+
+    cut(handle);
+
+    Node *children = mergePairs(handle->child_); //the node's children become a heap of their own
+
+    if(children != nullptr)
+    {
+        root_ = link(root_, children);
+    }
+
+    delete handle;
+    item_count_--;
+}
+
+template<typename ItemType, typename PriorityType>
+void PairingHeap<ItemType, PriorityType>::merge(PairingHeap &other)
+{
+    if(this == &other || other.root_ == nullptr)
+    {
+        return;
+    }
+
+    root_ = root_ == nullptr ? other.root_ : link(root_, other.root_);
+    item_count_ += other.item_count_;
+
+    other.root_ = nullptr;
+    other.item_count_ = 0;
+}
+
+template<typename ItemType, typename PriorityType>
+const ItemType &PairingHeap<ItemType, PriorityType>::top() const
+{
+    if(isEmpty())
+    {
+        throw(std::out_of_range("Heap is empty!"));
+    }
+
+    return root_->item_;
+}
+
+template<typename ItemType, typename PriorityType>
+PriorityType PairingHeap<ItemType, PriorityType>::topPriority() const
+{
+    if(isEmpty())
+    {
+        throw(std::out_of_range("Heap is empty!"));
+    }
+
+    return root_->priority_;
+}
+
+template<typename ItemType, typename PriorityType>
+PriorityType PairingHeap<ItemType, PriorityType>::getPriority(Handle handle) const
+{
+    return handle->priority_;
+}
+
+template<typename ItemType, typename PriorityType>
+void PairingHeap<ItemType, PriorityType>::clear()
+{
+    Node *stack = root_; //nodes still to delete, linked through 'sibling_'; iterative, so that a deep heap cannot overflow the call stack
+
+    while(stack != nullptr)
+    {
+        Node *curr_node = stack;
+        stack = curr_node->sibling_;
+
+        if(curr_node->child_ != nullptr) //push the node's list of children onto the stack
+        {
+            Node *last_child = curr_node->child_;
+
+            while(last_child->sibling_ != nullptr)
+            {
+                last_child = last_child->sibling_;
+            }
+
+            last_child->sibling_ = stack;
+            stack = curr_node->child_;
+        }
+
+        delete curr_node;
+    }
+
+    root_ = nullptr;
+    item_count_ = 0;
+}
+
+template<typename ItemType, typename PriorityType>
+size_t PairingHeap<ItemType, PriorityType>::size() const
+{
+    return item_count_;
+}
+
+template<typename ItemType, typename PriorityType>
+bool PairingHeap<ItemType, PriorityType>::isEmpty() const
+{
+    return root_ == nullptr;
+}
+
+template<typename ItemType, typename PriorityType>
+void PairingHeap<ItemType, PriorityType>::peek() const
+{
+    if(isEmpty())
+    {
+        std::cout << "List is empty!";
+    }
+    else
+    {
+        std::cout << root_->item_;
+    }
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+template<typename ItemType, typename PriorityType>
+typename PairingHeap<ItemType, PriorityType>::Node *PairingHeap<ItemType, PriorityType>::link(Node *first, Node *second)
+{
+    if(second->priority_ < first->priority_)
+    {
+        std::swap(first, second);
+    }
+
+    //make 'second' the first child of 'first'
+    second->sibling_ = first->child_;
+
+    if(first->child_ != nullptr)
+    {
+        first->child_->prev_ = second;
+    }
+
+    second->prev_ = first;
+    first->child_ = second;
+
+    return first;
+}
+
+template<typename ItemType, typename PriorityType>
+typename PairingHeap<ItemType, PriorityType>::Node *PairingHeap<ItemType, PriorityType>::mergePairs(Node *first)
+{
+    if(first == nullptr)
+    {
+        return nullptr;
+    }
+
+    Node *pairs = nullptr; //joined pairs, linked through 'sibling_' in reverse order
+
+    //first pass; join the heaps two at a time from left to right
+    while(first != nullptr)
+    {
+        Node *a = first;
+        Node *b = a->sibling_;
+
+        if(b == nullptr) //an odd heap out is carried over as it is
+        {
+            a->prev_ = nullptr;
+            a->sibling_ = pairs;
+            pairs = a;
+            break;
+        }
+
+        first = b->sibling_;
+        a->sibling_ = a->prev_ = nullptr;
+        b->sibling_ = b->prev_ = nullptr;
+
+        Node *pair = link(a, b);
+        pair->sibling_ = pairs;
+        pairs = pair;
+    }
+
+    //second pass; join the pairs from right to left into a single heap
+    Node *result = pairs;
+    pairs = pairs->sibling_;
+    result->sibling_ = nullptr;
+
+    while(pairs != nullptr)
+    {
+        Node *next = pairs->sibling_;
+        pairs->sibling_ = nullptr;
+        result = link(result, pairs);
+        pairs = next;
+    }
+
+    result->prev_ = nullptr;
+
+    return result;
+}
+
+template<typename ItemType, typename PriorityType>
+void PairingHeap<ItemType, PriorityType>::cut(Node *node)
+{
+    if(node->prev_->child_ == node) //the first child; its parent's child list now starts at its sibling
+    {
+        node->prev_->child_ = node->sibling_;
+    }
+    else
+    {
+        node->prev_->sibling_ = node->sibling_;
+    }
+
+    if(node->sibling_ != nullptr)
+    {
+        node->sibling_->prev_ = node->prev_;
+    }
+
+    node->sibling_ = nullptr;
+    node->prev_ = nullptr;
+}
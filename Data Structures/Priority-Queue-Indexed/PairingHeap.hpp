@@ -0,0 +1,151 @@
+/*
+Title: Pairing Heap
+Author: Edwin Khew
+Description: Pairing heap class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef PAIRING_HEAP_H_
+#define PAIRING_HEAP_H_
+
+#include <cstddef>
+
+/*
+    a min-heap made of nodes that each keep a list of child heaps; pushing, merging two heaps, and lowering a priority are O(1), and removing the front is O(log n) amortized
+    the handle of an item is a pointer to its node, so it stays valid no matter how the heap is restructured; this makes it a good fit for workloads that lower priorities far more often than they pop
+*/
+template <class ItemType, class PriorityType = int>
+class PairingHeap
+{
+private:
+    struct Node;
+public:
+    typedef Node *Handle; //identifies an item of the heap until it is removed
+
+    /*
+        default constructor
+    */
+    PairingHeap();
+
+    /*
+        destructor
+    */
+    ~PairingHeap();
+
+    PairingHeap(const PairingHeap &) = delete;
+    PairingHeap &operator=(const PairingHeap &) = delete;
+
+    /*
+        inserts a new item into the heap, based on its priority; items with lower priority values leave the heap first
+        @param new_item, item to be inserted
+        @param priority, priority of the item
+        @return the handle of the new item; valid until the item leaves the heap
+    */
+    Handle push(const ItemType &new_item, PriorityType priority);
+
+    /*
+        removes the item at the front of the heap
+        @return true if the item was successfully removed, and false otherwise
+    */
+    bool pop();
+
+    /*
+        lowers the priority of an item, moving it towards the front of the heap
+        @param handle, handle of the item; must belong to an item in this heap
+        @param new_priority, the new priority; must not be greater than the current one
+    */
+    void decreaseKey(Handle handle, PriorityType new_priority);
+
+    /*
+        removes an item from anywhere in the heap
+        @param handle, handle of the item to remove; must belong to an item in this heap
+    */
+    void erase(Handle handle);
+
+    /*
+        moves every item of another heap into this one in O(1); handles of the other heap's items stay valid and now belong to this heap
+        @param other, heap to merge in; left empty
+    */
+    void merge(PairingHeap &other);
+
+    /*
+        returns the item at the front of the heap
+        @return a reference to the item with the lowest priority value; valid until the item leaves the heap
+    */
+    const ItemType &top() const;
+
+    /*
+        returns the priority of the item at the front of the heap
+        @return the lowest priority value in the heap
+    */
+    PriorityType topPriority() const;
+
+    /*
+        returns the current priority of an item
+        @param handle, handle of the item
+        @return the item's priority
+    */
+    PriorityType getPriority(Handle handle) const;
+
+    /*
+        clears the heap; every handle becomes invalid
+        @post heap is now empty
+    */
+    void clear();
+
+    /*
+        returns the current number of items in the heap
+        @return the number of items in the heap
+    */
+    size_t size() const;
+
+    /*
+        checks if the heap is empty
+        @return true if the heap is empty, and false otherwise
+    */
+    bool isEmpty() const;
+
+    /*
+        prints a copy of the item at the front of the heap
+    */
+    void peek() const;
+private:
+    /*
+        a node of the heap; its children form a doubly linked list through 'sibling_' and 'prev_'
+    */
+    struct Node
+    {
+        ItemType item_; //the item itself
+        PriorityType priority_; //priority of the item
+        Node *child_; //first (leftmost) child
+        Node *sibling_; //next sibling to the right
+        Node *prev_; //previous sibling, or the parent if this is the first child
+    };
+
+    Node *root_; //node with the lowest priority
+    size_t item_count_; //current number of items in the heap
+
+    /*
+        joins two heaps by making the root with the greater priority the first child of the other
+        @param first, root of the first heap; has no siblings or parent
+        @param second, root of the second heap; has no siblings or parent
+        @return the root of the joined heap
+    */
+    Node *link(Node *first, Node *second);
+
+    /*
+        joins a list of sibling heaps into one, pairing them up from left to right and then joining the pairs from right to left; the two passes are what keep removing the front O(log n) amortized
+        @param first, the first heap of the list
+        @return the root of the joined heap, or 'nullptr' if the list is empty
+    */
+    Node *mergePairs(Node *first);
+
+    /*
+        detaches a node that is not the root, along with its children, from its parent and siblings
+        @param node, node to detach
+    */
+    void cut(Node *node);
+};
+
+#include "PairingHeap.cpp"
+#endif
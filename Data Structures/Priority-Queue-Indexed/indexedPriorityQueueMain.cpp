@@ -0,0 +1,79 @@
+/*
+Title: Indexed Priority Queue (addressable binary heap)
+Author: Edwin Khew
+Description: Indexed priority queue and pairing heap class test file.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <string>
+#include "IndexedPriorityQueue.hpp"
+#include "PairingHeap.hpp"
+
+using namespace std;
+
+int main()
+{
+    IndexedPriorityQueue<string> myQueue;
+
+    IndexedPriorityQueue<string>::Handle shelly = myQueue.push("Shelly", 5);
+    IndexedPriorityQueue<string>::Handle colt = myQueue.push("Colt", 3);
+    IndexedPriorityQueue<string>::Handle bull = myQueue.push("Bull", 8);
+    myQueue.push("Penny", 4);
+    myQueue.push("Brock", 6);
+
+    myQueue.decreaseKey(bull, 1); //Bull moves to the front
+    myQueue.erase(colt);
+
+    //myQueue.decreaseKey(shelly, 9); //invalid argument test; priorities can only be lowered
+    //myQueue.erase(colt); //out of range test; the handle was already erased
+
+    cout << "Peek: ";
+    myQueue.peek();
+    cout << endl << "Top: " << myQueue.top() << " (" << myQueue.topPriority() << ")" << endl;
+    cout << "Size: " << myQueue.size() << endl;
+    cout << "Empty?: " << myQueue.isEmpty() << endl;
+    cout << "Contains Colt?: " << myQueue.contains(colt) << endl;
+    cout << "Shelly's Priority: " << myQueue.getPriority(shelly) << endl;
+
+    cout << "Dequeue Order: ";
+
+    while(!myQueue.isEmpty())
+    {
+        cout << myQueue.top() << " ";
+        myQueue.pop();
+    }
+
+    cout << endl << endl;
+
+    /*
+        pairing heap test
+    */
+    PairingHeap<string> myHeap;
+    PairingHeap<string> myOtherHeap;
+
+    PairingHeap<string>::Handle jessie = myHeap.push("Jessie", 7);
+    PairingHeap<string>::Handle nita = myHeap.push("Nita", 9);
+    myHeap.push("Poco", 2);
+    myOtherHeap.push("Dynamike", 5);
+    myOtherHeap.push("Rico", 10);
+
+    myHeap.merge(myOtherHeap); //O(1); every item of 'myOtherHeap' moves over
+    myHeap.decreaseKey(nita, 1);
+    myHeap.erase(jessie);
+
+    cout << "Peek (Pairing Heap): ";
+    myHeap.peek();
+    cout << endl << "Size (Pairing Heap): " << myHeap.size() << endl;
+    cout << "Empty? (Merged Heap): " << myOtherHeap.isEmpty() << endl;
+
+    cout << "Dequeue Order (Pairing Heap): ";
+
+    while(!myHeap.isEmpty())
+    {
+        cout << myHeap.top() << " ";
+        myHeap.pop();
+    }
+
+    cout << endl;
+}
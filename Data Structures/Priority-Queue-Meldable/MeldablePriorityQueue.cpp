@@ -0,0 +1,223 @@
+/*
+Title: Meldable Priority Queue (leftist heap)
+Author: Edwin Khew
+Description: Meldable priority queue class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <stdexcept> //for std::out_of_range
+#include <utility> //for std::swap and std::pair
+#include <vector> //for the explicit stacks used to copy and delete heaps
+
+template<typename ItemType>
+MeldablePriorityQueue<ItemType>::MeldablePriorityQueue():root_(nullptr), item_count_(0), next_sequence_(0) { }
+
+template<typename ItemType>
+MeldablePriorityQueue<ItemType>::MeldablePriorityQueue(const MeldablePriorityQueue<ItemType> &queue):root_(nullptr), item_count_(queue.item_count_), next_sequence_(queue.next_sequence_)
+{
+    std::vector<std::pair<const Node *, Node **>> stack; //nodes still to copy, along with the link the copy goes into
+
+    stack.push_back(std::make_pair(queue.root_, &root_));
+
+    while(!stack.empty())
+    {
+        const Node *orig_node = stack.back().first;
+        Node **link = stack.back().second;
+        stack.pop_back();
+
+        if(orig_node == nullptr)
+        {
+            continue;
+        }
+
+        *link = new Node{orig_node->item_, orig_node->priority_, orig_node->sequence_, orig_node->rank_, nullptr, nullptr};
+
+        stack.push_back(std::make_pair(orig_node->left_, &(*link)->left_));
+        stack.push_back(std::make_pair(orig_node->right_, &(*link)->right_));
+    }
+}
+
+template<typename ItemType>
+MeldablePriorityQueue<ItemType>::~MeldablePriorityQueue()
+{
+    clear();
+}
+
+template<typename ItemType>
+bool MeldablePriorityQueue<ItemType>::enqueue(const ItemType &new_item, int priority)
+{
+    Node *new_node = new Node{new_item, priority, next_sequence_, 1, nullptr, nullptr}; //stamp the item with its insertion order
+    next_sequence_++;
+
+    root_ = mergeNodes(root_, new_node); //a single node is a heap of its own
+    item_count_++;
+
+    return true;
+}
+
+template<typename ItemType>
+bool MeldablePriorityQueue<ItemType>::dequeue()
+{
+    if(!isEmpty())
+    {
+        Node *old_root = root_;
+        root_ = mergeNodes(old_root->left_, old_root->right_); //the two subtrees of the root are heaps of their own
+
+        delete old_root;
+        item_count_--;
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+template<typename ItemType>
+void MeldablePriorityQueue<ItemType>::merge(MeldablePriorityQueue<ItemType> &other)
+{
+    if(this == &other)
+    {
+        return;
+    }
+
+    root_ = mergeNodes(root_, other.root_);
+    item_count_ += other.item_count_;
+
+    if(next_sequence_ < other.next_sequence_) //items inserted from now on come after every item of both queues
+    {
+        next_sequence_ = other.next_sequence_;
+    }
+
+    other.root_ = nullptr;
+    other.item_count_ = 0;
+    other.next_sequence_ = 0;
+}
+
+template<typename ItemType>
+void MeldablePriorityQueue<ItemType>::clear()
+{
+    deleteNodes(root_);
+
+    root_ = nullptr;
+    item_count_ = 0;
+    next_sequence_ = 0;
+}
+
+template<typename ItemType>
+size_t MeldablePriorityQueue<ItemType>::size() const
+{
+    return item_count_;
+}
+
+template<typename ItemType>
+bool MeldablePriorityQueue<ItemType>::isEmpty() const
+{
+    return root_ == nullptr;
+}
+
+template<typename ItemType>
+ItemType MeldablePriorityQueue<ItemType>::top() const
+{
+    if(isEmpty())
+    {
+        throw(std::out_of_range("Queue is empty!"));
+    }
+
+    return root_->item_;
+}
+
+template<typename ItemType>
+void MeldablePriorityQueue<ItemType>::peek() const
+{
+    if(!isEmpty())
+    {
+        std::cout << root_->item_;
+    }
+    else
+    {
+        std::cout << "List is empty!";
+    }
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+template<typename ItemType>
+typename MeldablePriorityQueue<ItemType>::Node *MeldablePriorityQueue<ItemType>::mergeNodes(Node *first, Node *second)
+{
+    if(first == nullptr)
+    {
+        return second;
+    }
+
+    if(second == nullptr)
+    {
+        return first;
+    }
+
+    if(before(second, first)) //the node that leaves first becomes the root
+    {
+        std::swap(first, second);
+    }
+
+    first->right_ = mergeNodes(first->right_, second);
+
+    if(rankOf(first->left_) < rankOf(first->right_)) //swap the children if needed, so that the right path stays the short one
+    {
+        std::swap(first->left_, first->right_);
+    }
+
+    first->rank_ = rankOf(first->right_) + 1;
+
+    return first;
+}
+
+template<typename ItemType>
+bool MeldablePriorityQueue<ItemType>::before(const Node *first, const Node *second) const
+{
+    if(first->priority_ != second->priority_)
+    {
+        return first->priority_ < second->priority_; //lower priority values leave first
+    }
+
+    return first->sequence_ < second->sequence_; //among equal priorities, the earlier insert leaves first
+}
+
+template<typename ItemType>
+int MeldablePriorityQueue<ItemType>::rankOf(const Node *node) const
+{
+    return node == nullptr ? 0 : node->rank_;
+}
+
+template<typename ItemType>
+void MeldablePriorityQueue<ItemType>::deleteNodes(Node *root)
+{
+    std::vector<Node *> stack; //nodes still to delete
+
+    if(root != nullptr)
+    {
+        stack.push_back(root);
+    }
+
+    while(!stack.empty())
+    {
+        Node *curr_node = stack.back();
+        stack.pop_back();
+
+        if(curr_node->left_ != nullptr)
+        {
+            stack.push_back(curr_node->left_);
+        }
+
+        if(curr_node->right_ != nullptr)
+        {
+            stack.push_back(curr_node->right_);
+        }
+
+        delete curr_node;
+    }
+}
@@ -0,0 +1,136 @@
+/*
+Title: Meldable Priority Queue (leftist heap)
+Author: Edwin Khew
+Description: Meldable priority queue class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef MELDABLE_PRIORITY_QUEUE_H_
+#define MELDABLE_PRIORITY_QUEUE_H_
+
+#include <cstdint>
+
+/*
+    a priority queue with the same interface as 'PriorityQueue', plus an O(log n) 'merge' that takes over every item of another queue without copying or reinserting any of them
+    the queue is a leftist heap; every node's right path is no longer than its left one, so the right path of the whole heap is at most log2(n + 1) nodes long, and merging only walks down the right paths of the two heaps
+*/
+template <class ItemType>
+class MeldablePriorityQueue
+{
+public:
+    /*
+        default constructor
+    */
+    MeldablePriorityQueue();
+
+    /*
+        copy constructor
+        @param queue to be copied
+    */
+    MeldablePriorityQueue(const MeldablePriorityQueue<ItemType> &queue);
+
+    /*
+        destructor
+    */
+    ~MeldablePriorityQueue();
+
+    MeldablePriorityQueue &operator=(const MeldablePriorityQueue &) = delete;
+
+    /*
+        inserts a new item into the queue, based on its priority; items with lower priority values leave the queue first, and items with equal priorities leave in the order they were inserted
+        @param new_item, item to be inserted
+        @param priority, priority of the item
+        @return true if the item was successfully inserted, and false otherwise
+    */
+    bool enqueue(const ItemType &new_item, int priority);
+
+    /*
+        removes the item at the front of the queue
+        @return true if the item was successfully removed, and false otherwise
+    */
+    bool dequeue();
+
+    /*
+        moves every item of another queue into this one in O(log n); items with equal priorities that came from different queues leave in the order of their positions within their own queues
+        @param other, queue to merge in; left empty
+    */
+    void merge(MeldablePriorityQueue<ItemType> &other);
+
+    /*
+        clears the queue
+        @post queue is now empty
+    */
+    void clear();
+
+    /*
+        returns the current number of items in the queue
+        @return item_count_
+    */
+    size_t size() const;
+
+    /*
+        checks if the queue is empty
+        @return true if the queue is empty, and false otherwise
+    */
+    bool isEmpty() const;
+
+    /*
+        returns the item at the front of the queue
+        @return a copy of the item with the lowest priority value
+    */
+    ItemType top() const;
+
+    /*
+        prints a copy of the item at the front of the queue
+    */
+    void peek() const;
+private:
+    /*
+        a node of the leftist heap
+    */
+    struct Node
+    {
+        ItemType item_; //the item itself
+        int priority_; //priority of the item
+        uint64_t sequence_; //number of items inserted into the queue before this one; breaks ties between equal priorities
+        int rank_; //number of nodes on the path down the right children to the first missing child; never greater for the right child than for the left one
+        Node *left_; //left child
+        Node *right_; //right child
+    };
+
+    Node *root_; //node at the front of the queue
+    size_t item_count_; //current number of items in the queue
+    uint64_t next_sequence_; //sequence number of the next inserted item
+
+    /*
+        merges two leftist heaps; recursive, but only along the right paths, so the depth is O(log n)
+        @param first, root of the first heap, or 'nullptr'
+        @param second, root of the second heap, or 'nullptr'
+        @return root of the merged heap
+    */
+    Node *mergeNodes(Node *first, Node *second);
+
+    /*
+        checks if a node leaves the queue before another one
+        @param first, first node
+        @param second, second node
+        @return true if 'first' has a lower priority value, or the same priority value and was inserted earlier
+    */
+    bool before(const Node *first, const Node *second) const;
+
+    /*
+        returns the rank of a node; an empty heap has rank 0
+        @param node, the node, or 'nullptr'
+        @return the rank of the node
+    */
+    int rankOf(const Node *node) const;
+
+    /*
+        deletes every node of a heap; iterative, since the left paths of a leftist heap can be as long as the heap itself
+        @param root, root of the heap to delete
+    */
+    void deleteNodes(Node *root);
+};
+
+#include "MeldablePriorityQueue.cpp"
+#endif
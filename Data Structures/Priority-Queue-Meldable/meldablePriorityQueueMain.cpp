@@ -0,0 +1,110 @@
+/*
+Title: Meldable Priority Queue (leftist heap)
+Author: Edwin Khew
+Description: Meldable priority queue test file.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <string>
+#include "MeldablePriorityQueue.hpp"
+
+using namespace std;
+
+int main()
+{
+    MeldablePriorityQueue<string> myQueue;
+
+    myQueue.enqueue("five", 5);
+    myQueue.enqueue("one", 1);
+    myQueue.enqueue("three", 3);
+    myQueue.enqueue("three-2", 3);
+
+    MeldablePriorityQueue<string> myOtherQueue;
+
+    myOtherQueue.enqueue("two", 2);
+    myOtherQueue.enqueue("four", 4);
+    myOtherQueue.enqueue("six", 6);
+
+    myQueue.merge(myOtherQueue); //O(log n); no item is copied or reinserted
+    myQueue.enqueue("three-3", 3);
+
+    //myQueue.dequeue();
+    //myQueue.dequeue();
+
+    cout << "Peek: ";
+    myQueue.peek();
+    cout << endl << "Top: " << myQueue.top() << endl;
+    cout << "Empty?: " << myQueue.isEmpty() << endl;
+    cout << "Size: " << myQueue.size() << endl;
+    cout << "Empty? (Merged Queue): " << myOtherQueue.isEmpty() << endl << endl;
+
+    /*
+        copy constructor test
+    */
+    MeldablePriorityQueue<string> myCopiedQueue = myQueue;
+    cout << "Peek (Copied List): ";
+    myCopiedQueue.peek();
+    cout << endl << "Size (Copied List): " << myCopiedQueue.size() << endl;
+
+    cout << "Dequeue Order (Copied List): ";
+
+    while(!myCopiedQueue.isEmpty())
+    {
+        cout << myCopiedQueue.top() << " ";
+        myCopiedQueue.dequeue();
+    }
+
+    cout << endl << endl;
+
+    /*
+        shard merge test; 64 queues of 10000 items each are combined into one
+    */
+    const int SHARD_COUNT = 64;
+    const int ITEMS_PER_SHARD = 10000;
+
+    MeldablePriorityQueue<int> myShards[SHARD_COUNT];
+
+    for(int s = 0; s < SHARD_COUNT; s++)
+    {
+        for(int i = 0; i < ITEMS_PER_SHARD; i++)
+        {
+            myShards[s].enqueue(s * ITEMS_PER_SHARD + i, (i * 7919 + s) % 100000);
+        }
+    }
+
+    for(int s = 1; s < SHARD_COUNT; s++)
+    {
+        myShards[0].merge(myShards[s]);
+    }
+
+    int previous = -1;
+    bool ordered = true;
+
+    cout << "Size (Merged Shards): " << myShards[0].size() << endl;
+
+    while(!myShards[0].isEmpty())
+    {
+        int item = myShards[0].top();
+        int priority = (item % ITEMS_PER_SHARD * 7919 + item / ITEMS_PER_SHARD) % 100000;
+
+        if(priority < previous)
+        {
+            ordered = false;
+        }
+
+        previous = priority;
+        myShards[0].dequeue();
+    }
+
+    cout << "In Order? (Merged Shards): " << ordered << endl << endl;
+
+    /*
+        clear method test
+    */
+    myQueue.clear();
+    cout << "Peek (After clear): ";
+    myQueue.peek();
+    cout << endl << "Empty? (After clear): " << myQueue.isEmpty() << endl;
+    cout << "Size (After clear): " << myQueue.size() << endl;
+}
@@ -0,0 +1,142 @@
+/*
+Title: Bucket Queue (calendar queue)
+Author: Edwin Khew
+Description: Bucket queue class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <limits> //for std::numeric_limits
+#include <stdexcept> //for std::out_of_range and std::invalid_argument
+
+template<typename KeyType, typename ItemType>
+BucketQueue<KeyType, ItemType>::BucketQueue(KeyType max_span):max_span_(max_span), current_(0), item_count_(0)
+{
+    //the number of buckets has to be a power of two greater than 'max_span', and the largest power of two a size_t can hold is one more than half its maximum; any larger span would overflow the count below
+    if(max_span > std::numeric_limits<size_t>::max() / 2)
+    {
+        throw(std::invalid_argument("Span is too large for the queue!"));
+    }
+
+    size_t bucket_count = 1;
+
+    while(bucket_count <= static_cast<size_t>(max_span)) //round up to a power of two, so that a key's bucket is found with a mask instead of a division
+    {
+        bucket_count *= 2;
+    }
+
+    buckets_ = new std::vector<ItemType>[bucket_count];
+    bucket_mask_ = bucket_count - 1;
+}
+
+template<typename KeyType, typename ItemType>
+BucketQueue<KeyType, ItemType>::~BucketQueue()
+{
+    delete[] buckets_;
+    buckets_ = nullptr;
+}
+
+template<typename KeyType, typename ItemType>
+void BucketQueue<KeyType, ItemType>::push(KeyType key, const ItemType &new_item)
+{
+    if(key < current_ || key - current_ > max_span_)
+    {
+        throw(std::out_of_range("Key is outside the span of the queue!"));
+    }
+
+    buckets_[key & bucket_mask_].push_back(new_item);
+    item_count_++;
+}
+
+template<typename KeyType, typename ItemType>
+bool BucketQueue<KeyType, ItemType>::pop()
+{
+    if(isEmpty())
+    {
+        return false;
+    }
+
+    advance();
+
+    buckets_[current_ & bucket_mask_].pop_back();
+    item_count_--;
+
+    return true;
+}
+
+template<typename KeyType, typename ItemType>
+const ItemType &BucketQueue<KeyType, ItemType>::top() const
+{
+    if(isEmpty())
+    {
+        throw(std::out_of_range("Queue is empty!"));
+    }
+
+    advance();
+
+    return buckets_[current_ & bucket_mask_].back();
+}
+
+template<typename KeyType, typename ItemType>
+KeyType BucketQueue<KeyType, ItemType>::topKey() const
+{
+    if(isEmpty())
+    {
+        throw(std::out_of_range("Queue is empty!"));
+    }
+
+    advance();
+
+    return current_;
+}
+
+template<typename KeyType, typename ItemType>
+void BucketQueue<KeyType, ItemType>::clear()
+{
+    for(size_t i = 0; i <= bucket_mask_; i++)
+    {
+        buckets_[i].clear(); //keeps the memory of every bucket for reuse
+    }
+
+    current_ = 0;
+    item_count_ = 0;
+}
+
+template<typename KeyType, typename ItemType>
+size_t BucketQueue<KeyType, ItemType>::size() const
+{
+    return item_count_;
+}
+
+template<typename KeyType, typename ItemType>
+bool BucketQueue<KeyType, ItemType>::isEmpty() const
+{
+    return item_count_ == 0;
+}
+
+template<typename KeyType, typename ItemType>
+void BucketQueue<KeyType, ItemType>::peek() const
+{
+    if(!isEmpty())
+    {
+        std::cout << top();
+    }
+    else
+    {
+        std::cout << "Queue is empty!";
+    }
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+template<typename KeyType, typename ItemType>
+void BucketQueue<KeyType, ItemType>::advance() const
+{
+    //every key is within 'max_span_' of 'current_', so a non-empty bucket is found before the walk gets all the way around
+    while(buckets_[current_ & bucket_mask_].empty())
+    {
+        current_++;
+    }
+}
@@ -0,0 +1,99 @@
+/*
+Title: Bucket Queue (calendar queue)
+Author: Edwin Khew
+Description: Bucket queue class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef BUCKET_QUEUE_H_
+#define BUCKET_QUEUE_H_
+
+#include <cstdint>
+#include <type_traits> //for std::is_unsigned
+#include <vector>
+
+/*
+    a min-priority queue for unsigned integer keys that never go below the front of the queue, and never run more than a fixed span ahead of it; Dijkstra's algorithm with integer edge weights no greater than the span is the classic case (Dial's algorithm)
+    there is one bucket for every key in the span, arranged in a circle like the days of a calendar; an item is appended to the bucket of its key, and the front walks around the circle to the next non-empty bucket. Pushing and popping are O(1), plus O(span) over the whole walk around the circle
+*/
+template <class KeyType, class ItemType>
+class BucketQueue
+{
+public:
+    static_assert(std::is_unsigned<KeyType>::value, "Bucket queue keys have to be unsigned integers!");
+
+    /*
+        constructor
+        @param max_span, the largest difference between any key in the queue and the key at the front; for Dijkstra's algorithm, the largest edge weight. Must be no more than half the largest size_t
+    */
+    BucketQueue(KeyType max_span);
+
+    /*
+        destructor
+    */
+    ~BucketQueue();
+
+    BucketQueue(const BucketQueue &) = delete;
+    BucketQueue &operator=(const BucketQueue &) = delete;
+
+    /*
+        inserts a new item into the queue
+        @param key, key of the item; must not be smaller than the key last read or removed from the front of the queue, nor more than 'max_span' greater than it
+        @param new_item, item to be inserted
+    */
+    void push(KeyType key, const ItemType &new_item);
+
+    /*
+        removes an item with the smallest key; items with equal keys leave in no particular order
+        @return true if the item was successfully removed, and false otherwise
+    */
+    bool pop();
+
+    /*
+        returns an item with the smallest key
+        @return a reference to the item; valid until the queue is next modified
+    */
+    const ItemType &top() const;
+
+    /*
+        returns the smallest key in the queue
+        @return the key of the item at the front of the queue
+    */
+    KeyType topKey() const;
+
+    /*
+        removes every item from the queue, and allows any key to be inserted again
+    */
+    void clear();
+
+    /*
+        returns the current number of items in the queue
+        @return the number of items in the queue
+    */
+    size_t size() const;
+
+    /*
+        checks if the queue is empty
+        @return true if the queue is empty, and false otherwise
+    */
+    bool isEmpty() const;
+
+    /*
+        prints the item at the front of the queue
+    */
+    void peek() const;
+private:
+    std::vector<ItemType> *buckets_; //circular array of buckets; the items with key 'k' are in bucket 'k & bucket_mask_', and no two keys in the span share a bucket
+    size_t bucket_mask_; //number of buckets minus one; the number of buckets is a power of two greater than 'max_span_'
+    KeyType max_span_; //the largest difference between any key in the queue and 'current_'
+    mutable KeyType current_; //key last read or removed from the front; every key in the queue is at least this
+    size_t item_count_; //current number of items in the queue
+
+    /*
+        moves 'current_' forward to the smallest key in the queue; the queue must not be empty
+    */
+    void advance() const;
+};
+
+#include "BucketQueue.cpp"
+#endif
@@ -0,0 +1,105 @@
+/*
+Title: Radix Heap
+Author: Edwin Khew
+Description: Radix heap class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef RADIX_HEAP_H_
+#define RADIX_HEAP_H_
+
+#include <cstdint>
+#include <type_traits> //for std::is_unsigned
+#include <utility> //for std::pair
+#include <vector>
+
+/*
+    a min-priority queue for unsigned integer keys that never go below the front of the queue, such as timestamps, or distances in Dijkstra's algorithm; items are never compared with each other
+    bucket 'i' holds the items whose key first differs from the key at the front at bit 'i - 1', and bucket 0 the items whose key equals it; removing an item takes it from bucket 0, and once bucket 0 runs out, the lowest non-empty bucket is split into the buckets below it. An item can only move down, so it is moved at most once per bit of the key, and every move is an append to a vector
+*/
+template <class KeyType, class ItemType>
+class RadixHeap
+{
+public:
+    static_assert(std::is_unsigned<KeyType>::value, "Radix heap keys have to be unsigned integers!");
+
+    /*
+        default constructor
+    */
+    RadixHeap();
+
+    /*
+        inserts a new item into the heap
+        @param key, key of the item; must not be smaller than the key last read or removed from the front of the heap
+        @param new_item, item to be inserted
+    */
+    void push(KeyType key, const ItemType &new_item);
+
+    /*
+        removes an item with the smallest key; items with equal keys leave in no particular order
+        @return true if the item was successfully removed, and false otherwise
+    */
+    bool pop();
+
+    /*
+        returns an item with the smallest key
+        @return a reference to the item; valid until the heap is next modified
+    */
+    const ItemType &top() const;
+
+    /*
+        returns the smallest key in the heap
+        @return the key of the item at the front of the heap
+    */
+    KeyType topKey() const;
+
+    /*
+        removes every item from the heap, and allows any key to be inserted again
+    */
+    void clear();
+
+    /*
+        returns the current number of items in the heap
+        @return the number of items in the heap
+    */
+    size_t size() const;
+
+    /*
+        checks if the heap is empty
+        @return true if the heap is empty, and false otherwise
+    */
+    bool isEmpty() const;
+
+    /*
+        prints the item at the front of the heap
+    */
+    void peek() const;
+private:
+    static const int BUCKET_COUNT_ = 8 * sizeof(KeyType) + 1; //one bucket for each bit of the key, plus one for keys equal to 'last_'
+
+    mutable std::vector<std::pair<KeyType, ItemType>> buckets_[BUCKET_COUNT_]; //key-item pairs by the highest bit in which their key differs from 'last_'; mutable, since reading the front may first have to split a bucket
+    mutable KeyType last_; //key last read or removed from the front; every key in the heap is at least this, and bucket 0 holds the items with exactly this key
+    size_t item_count_; //current number of items in the heap
+
+    /*
+        finds the bucket for a key
+        @param key, the key
+        @return the index of the bucket; 0 if the key equals 'last_', and otherwise one more than the highest bit in which the key differs from 'last_'
+    */
+    int bucketIndex(KeyType key) const;
+
+    /*
+        makes sure that bucket 0 holds the items with the smallest key, by splitting the lowest non-empty bucket if needed; the heap must not be empty
+    */
+    void refill() const;
+
+    /*
+        returns the position of the highest set bit of a non-zero value
+        @param value, the value
+        @return an integer from 0 to 63
+    */
+    static int highestBit(uint64_t value);
+};
+
+#include "RadixHeap.cpp"
+#endif
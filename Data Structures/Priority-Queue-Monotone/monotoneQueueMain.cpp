@@ -0,0 +1,93 @@
+/*
+Title: Radix Heap and Bucket Queue
+Author: Edwin Khew
+Description: Radix heap and bucket queue class test file.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <cstdint>
+#include <string>
+#include "RadixHeap.hpp"
+#include "BucketQueue.hpp"
+
+using namespace std;
+
+int main()
+{
+    RadixHeap<uint32_t, string> myHeap;
+
+    myHeap.push(5, "five");
+    myHeap.push(1, "one");
+    myHeap.push(3, "three");
+    myHeap.push(2, "two");
+    myHeap.push(4, "four");
+
+    //myHeap.pop();
+
+    cout << "Peek: ";
+    myHeap.peek();
+    cout << endl << "Top: " << myHeap.top() << " (" << myHeap.topKey() << ")" << endl;
+    cout << "Empty?: " << myHeap.isEmpty() << endl;
+    cout << "Size: " << myHeap.size() << endl;
+
+    myHeap.pop();
+    myHeap.push(6, "six"); //keys only have to be no smaller than the front
+    //myHeap.push(0, "zero"); //out of range test; smaller than the front
+
+    cout << "Dequeue Order: ";
+
+    while(!myHeap.isEmpty())
+    {
+        cout << myHeap.top() << " ";
+        myHeap.pop();
+    }
+
+    cout << endl << endl;
+
+    /*
+        timestamp test; a simulation where every event schedules the next one up to 100 ticks later, with 64-bit times
+    */
+    RadixHeap<uint64_t, int> myEvents;
+    BucketQueue<uint64_t, int> myCalendar(100);
+    uint64_t state = 1;
+    bool same = true;
+
+    for(int i = 0; i < 1000; i++)
+    {
+        myEvents.push(i % 100, i);
+        myCalendar.push(i % 100, i);
+    }
+
+    for(int i = 0; i < 100000; i++)
+    {
+        uint64_t now = myEvents.topKey();
+
+        if(now != myCalendar.topKey()) //both queues have to agree on the time of the next event
+        {
+            same = false;
+        }
+
+        myEvents.pop();
+        myCalendar.pop();
+
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        uint64_t delay = (state >> 33) % 101;
+
+        myEvents.push(now + delay, i);
+        myCalendar.push(now + delay, i);
+    }
+
+    cout << "Time (Events): " << myEvents.topKey() << endl;
+    cout << "Same Order? (Radix Heap vs Bucket Queue): " << same << endl;
+    cout << "Size (Events): " << myEvents.size() << endl << endl;
+
+    /*
+        clear method test
+    */
+    myCalendar.clear();
+    cout << "Peek (After clear): ";
+    myCalendar.peek();
+    cout << endl << "Empty? (After clear): " << myCalendar.isEmpty() << endl;
+    cout << "Size (After clear): " << myCalendar.size() << endl;
+}
@@ -8,6 +8,8 @@ Date Created: 6/3/2021
 #ifndef PRIORITY_QUEUE_H_
 #define PRIORITY_QUEUE_H_
 
+#include <cstdint>
+
 template <class ItemType>
 class PriorityQueue
 {
@@ -24,13 +26,9 @@ public:
     PriorityQueue(const PriorityQueue<ItemType> &queue);
 
     /*
-        destructor
-    */
-    ~PriorityQueue();
-
-    /*
-        inserts a new item into the queue, based on its priority
+        inserts a new item into the queue, based on its priority; items with lower priority values leave the queue first, and items with equal priorities leave in the order they were inserted
         @param new_item, item to be inserted
+        @param priority, priority of the item
         @return true if the item was successfully inserted, and false otherwise
     */
     bool enqueue(const ItemType &new_item, int priority);
@@ -48,7 +46,7 @@ public:
     void clear();
 
     /*
-        returns the current number of items in the queue (current number of nodes)
+        returns the current number of items in the queue
         @return item_count_
     */
     size_t size() const;
@@ -59,14 +57,36 @@ public:
     */
     bool isEmpty() const;
 
+    /*
+        returns the item at the front of the queue
+        @return a copy of the item with the lowest priority value
+    */
+    ItemType top() const;
+
     /*
         prints a copy of the item at the front of the queue
     */
     void peek() const;
 private:
-    Node<ItemType> *front_ptr_; //pointer to the first node in the queue
-    Node<ItemType> *back_ptr_; //pointer to the last node in the queue
-    size_t item_count_; //total number of items currently in the queue
+    /*
+        an item of the queue along with the order it leaves in
+    */
+    struct Entry
+    {
+        ItemType item_; //the item itself
+        int priority_; //priority of the item
+        uint64_t sequence_; //number of items inserted before this one; breaks ties between equal priorities
+
+        /*
+            checks if this entry leaves the queue before another one; the heap keeps the "greatest" entry at its root
+            @param other, entry to compare with
+            @return true if this entry has a lower priority value, or the same priority value and was inserted earlier
+        */
+        bool operator>(const Entry &other) const;
+    };
+
+    Heap<Entry> heap_; //binary heap of the entries; the entry at the root leaves first
+    uint64_t next_sequence_; //sequence number of the next inserted item
 };
 
 #include "PriorityQueue.cpp"
@@ -6,7 +6,7 @@ Date Created: 6/3/2021
 */
 
 #include <iostream>
-#include "Node.hpp"
+#include "Heap.hpp"
 #include "PriorityQueue.hpp"
 
 using namespace std;
@@ -30,7 +30,8 @@ int main()
 
     cout << "Peek: ";
     myQueue.peek();
-    cout << endl << "Empty?: " << myQueue.isEmpty() << endl;
+    cout << endl << "Top: " << myQueue.top() << endl;
+    cout << "Empty?: " << myQueue.isEmpty() << endl;
     cout << "Size: " << myQueue.size() << endl << endl;
 
     /*
@@ -43,6 +44,19 @@ int main()
     cout << "Size (Copied List): " << myCopiedQueue.size();
     cout << endl << endl;
 
+    /*
+        dequeue order test; items with equal priorities leave in the order they were inserted
+    */
+    cout << "Dequeue Order (Copied List): ";
+
+    while(!myCopiedQueue.isEmpty())
+    {
+        cout << myCopiedQueue.top() << " ";
+        myCopiedQueue.dequeue();
+    }
+
+    cout << endl << endl;
+
     /*
         clear method test
     */
@@ -0,0 +1,340 @@
+/*
+Title: Double-Array Trie
+Author: Edwin Khew
+Description: Double-array trie class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <stdexcept> //for std::invalid_argument
+
+DoubleArrayTrie::DoubleArrayTrie()
+{
+    clear();
+}
+
+DoubleArrayTrie::DoubleArrayTrie(const Trie &trie)
+{
+    build(trie);
+}
+
+DoubleArrayTrie::DoubleArrayTrie(const std::vector<std::string> &sorted_words)
+{
+    build(sorted_words);
+}
+
+void DoubleArrayTrie::build(const Trie &trie)
+{
+    clear();
+
+    buildFromNode(trie.root_ptr_, 0);
+    finishBuild();
+}
+
+void DoubleArrayTrie::build(const std::vector<std::string> &sorted_words)
+{
+    //check the whole list first, so that a bad list leaves the trie as it was
+    for(size_t i = 0; i < sorted_words.size(); i++)
+    {
+        for(size_t j = 0; j < sorted_words[i].length(); j++)
+        {
+            if(letterCode(sorted_words[i][j]) < 0)
+            {
+                throw(std::invalid_argument("Words can only contain the letters a-z!"));
+            }
+        }
+
+        if(i > 0 && sorted_words[i] < sorted_words[i - 1])
+        {
+            throw(std::invalid_argument("Word list is not sorted!"));
+        }
+    }
+
+    clear();
+
+    buildFromRange(sorted_words, 0, sorted_words.size(), 0, 0);
+    finishBuild();
+}
+
+void DoubleArrayTrie::clear()
+{
+    units_.assign(1, Unit{0, 0}); //the root; its own parent, so that it is never mistaken for a free unit
+    occurrence_counts_.assign(1, 0);
+    word_counts_.assign(1, 0);
+    first_free_ = 1;
+    node_count_ = 1;
+}
+
+bool DoubleArrayTrie::search(const std::string &word) const
+{
+    int32_t index = findNode(word); //index of the last node of the word if found, or -1 if not found
+
+    return index >= 0 && occurrence_counts_[index] > 0; //true if the word exists and not just as a prefix of a larger word
+}
+
+int DoubleArrayTrie::getWordCount() const
+{
+    return word_counts_[0];
+}
+
+int DoubleArrayTrie::getPrefixCount(const std::string &prefix) const
+{
+    int32_t index = findNode(prefix);
+
+    return index >= 0 ? word_counts_[index] : 0;
+}
+
+int DoubleArrayTrie::getOccurrenceCount(const std::string &word) const
+{
+    int32_t index = findNode(word);
+
+    return index >= 0 ? occurrence_counts_[index] : 0;
+}
+
+bool DoubleArrayTrie::isEmpty() const
+{
+    return word_counts_[0] == 0;
+}
+
+size_t DoubleArrayTrie::nodeCount() const
+{
+    return node_count_;
+}
+
+size_t DoubleArrayTrie::sizeInBytes() const
+{
+    return units_.capacity() * sizeof(Unit) + occurrence_counts_.capacity() * sizeof(uint32_t) + word_counts_.capacity() * sizeof(uint32_t);
+}
+
+void DoubleArrayTrie::display() const
+{
+    if(!isEmpty()) //can only display if trie is not empty
+    {
+        std::string word; //used to build words
+        displayHelper(0, word);
+    }
+    else
+    {
+        std::cout << "Trie is Empty!" << std::endl;
+    }
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+int DoubleArrayTrie::letterCode(char c)
+{
+    if(c < 'a' || c > 'z')
+    {
+        return -1;
+    }
+
+    return c - 'a' + 1;
+}
+
+int32_t DoubleArrayTrie::findNode(const std::string &word) const
+{
+    int32_t index = 0; //start at the root
+
+    for(size_t i = 0; i < word.length(); i++) //loop through every character in the word
+    {
+        int code = letterCode(word[i]);
+
+        if(code < 0) //a character outside a-z cannot be in the trie
+        {
+            return -1;
+        }
+
+        size_t child = static_cast<size_t>(units_[index].base_) + code; //where the child for this letter would be
+
+        //if the unit there is not a child of the current node, the word does not exist
+        if(child >= units_.size() || units_[child].check_ != index)
+        {
+            return -1;
+        }
+
+        index = static_cast<int32_t>(child); //traverse down the trie to the next character of the word
+    }
+
+    return index;
+}
+
+int32_t DoubleArrayTrie::placeChildren(int32_t parent, const std::vector<int> &codes)
+{
+    //try every free unit from 'first_free_' on as the position of the first child, until the other children fit as well
+    size_t position = first_free_ > static_cast<size_t>(codes[0]) ? first_free_ : codes[0];
+
+    while(true)
+    {
+        ensureSize(position + 1);
+
+        if(units_[position].check_ == FREE_)
+        {
+            size_t base = position - codes[0];
+            bool fits = true;
+
+            ensureSize(base + codes.back() + 1);
+
+            for(size_t i = 1; i < codes.size() && fits; i++)
+            {
+                fits = units_[base + codes[i]].check_ == FREE_;
+            }
+
+            if(fits)
+            {
+                for(size_t i = 0; i < codes.size(); i++) //claim the units for the children
+                {
+                    units_[base + codes[i]].check_ = parent;
+                }
+
+                node_count_ += codes.size();
+
+                while(first_free_ < units_.size() && units_[first_free_].check_ != FREE_)
+                {
+                    first_free_++;
+                }
+
+                return static_cast<int32_t>(base);
+            }
+        }
+
+        position++;
+    }
+}
+
+void DoubleArrayTrie::ensureSize(size_t size)
+{
+    if(size > units_.size()) //vectors grow their capacity geometrically, so growing one unit at a time is still O(1) amortized
+    {
+        units_.resize(size, Unit{0, FREE_});
+        occurrence_counts_.resize(size, 0);
+        word_counts_.resize(size, 0);
+    }
+}
+
+uint32_t DoubleArrayTrie::buildFromNode(Node *node, int32_t index)
+{
+    std::vector<int> codes; //codes of the node's children, in increasing order
+    std::vector<Node *> children; //the node's children
+    uint32_t word_count = 0;
+
+    for(int i = 0; i < ALPHABET_SIZE_; i++) //loop through the children of the node
+    {
+        if(node->children_[i] != nullptr)
+        {
+            codes.push_back(i + 1);
+            children.push_back(node->children_[i]);
+        }
+    }
+
+    if(node->getEndOfWord())
+    {
+        occurrence_counts_[index] = node->getOccurrenceCount();
+        word_count = 1;
+    }
+
+    if(!codes.empty())
+    {
+        int32_t base = placeChildren(index, codes); //the children are placed before any of them is visited, so that every node's children sit together
+        units_[index].base_ = base;
+
+        for(size_t i = 0; i < children.size(); i++)
+        {
+            word_count += buildFromNode(children[i], base + codes[i]);
+        }
+    }
+
+    word_counts_[index] = word_count;
+
+    return word_count;
+}
+
+uint32_t DoubleArrayTrie::buildFromRange(const std::vector<std::string> &words, size_t first, size_t last, size_t depth, int32_t index)
+{
+    uint32_t word_count = 0;
+    size_t i = first;
+
+    //the words that end at this node come first in sorted order; each copy is one occurrence
+    while(i < last && words[i].length() == depth)
+    {
+        i++;
+    }
+
+    if(i > first)
+    {
+        occurrence_counts_[index] = static_cast<uint32_t>(i - first);
+        word_count = 1;
+    }
+
+    //the rest of the words are grouped by their next letter, and each group becomes a child
+    std::vector<int> codes; //codes of the node's children, in increasing order
+    std::vector<size_t> starts; //index of the first word of each child's group
+
+    for(size_t j = i; j < last; j++)
+    {
+        int code = letterCode(words[j][depth]);
+
+        if(codes.empty() || code != codes.back())
+        {
+            codes.push_back(code);
+            starts.push_back(j);
+        }
+    }
+
+    starts.push_back(last);
+
+    if(!codes.empty())
+    {
+        int32_t base = placeChildren(index, codes);
+        units_[index].base_ = base;
+
+        for(size_t j = 0; j < codes.size(); j++)
+        {
+            word_count += buildFromRange(words, starts[j], starts[j + 1], depth + 1, base + codes[j]);
+        }
+    }
+
+    word_counts_[index] = word_count;
+
+    return word_count;
+}
+
+void DoubleArrayTrie::finishBuild()
+{
+    size_t size = units_.size();
+
+    while(size > 1 && units_[size - 1].check_ == FREE_) //drop the free units after the last node
+    {
+        size--;
+    }
+
+    units_.resize(size);
+    occurrence_counts_.resize(size);
+    word_counts_.resize(size);
+
+    units_.shrink_to_fit();
+    occurrence_counts_.shrink_to_fit();
+    word_counts_.shrink_to_fit();
+}
+
+void DoubleArrayTrie::displayHelper(int32_t index, std::string &word) const
+{
+    //if the current node is the end of a word, print the word
+    if(occurrence_counts_[index] > 0)
+    {
+        std::cout << word << std::endl;
+    }
+
+    for(int code = 1; code <= ALPHABET_SIZE_; code++) //loop through the letters, in order
+    {
+        size_t child = static_cast<size_t>(units_[index].base_) + code;
+
+        if(child < units_.size() && units_[child].check_ == index)
+        {
+            word.push_back(static_cast<char>('a' + code - 1)); //add the letter to the word
+            displayHelper(static_cast<int32_t>(child), word); //recursively call the function to continue building the word
+            word.pop_back();
+        }
+    }
+}
@@ -0,0 +1,185 @@
+/*
+Title: Double-Array Trie
+Author: Edwin Khew
+Description: Double-array trie class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef DOUBLE_ARRAY_TRIE_H_
+#define DOUBLE_ARRAY_TRIE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+    a read-only, compact copy of a trie, built from a 'Trie' or from a sorted list of words
+    every node is a single 8-byte unit in one array, instead of a 'Node' with 26 child pointers; the child of node 's' for letter 'c' is the unit at 'base + c', which is only a child of 's' if that unit's 'check' is 's'. Following a letter costs one addition and one read from the same array, rather than a pointer chase to a separately allocated node
+*/
+class DoubleArrayTrie
+{
+public:
+    /*
+        default constructor; creates an empty trie
+    */
+    DoubleArrayTrie();
+
+    /*
+        builds the double-array trie from a trie; the trie is not changed
+        @param trie, the trie to copy
+    */
+    DoubleArrayTrie(const Trie &trie);
+
+    /*
+        builds the double-array trie from a list of words
+        @param sorted_words, the words in sorted order; a word that appears more than once is given that occurrence count
+    */
+    DoubleArrayTrie(const std::vector<std::string> &sorted_words);
+
+    /*
+        replaces the contents with a copy of a trie
+        @param trie, the trie to copy
+    */
+    void build(const Trie &trie);
+
+    /*
+        replaces the contents with a list of words
+        @param sorted_words, the words in sorted order; every word may only contain the letters a-z
+    */
+    void build(const std::vector<std::string> &sorted_words);
+
+    /*
+        removes every word
+    */
+    void clear();
+
+    /*
+        checks for the existence of a specified word
+        @param word, the word to search for
+        @return true if the word was found, and false if the word was not found
+    */
+    bool search(const std::string &word) const;
+
+    /*
+        returns the number of distinct words
+        @return an integer representing the number of words
+    */
+    int getWordCount() const;
+
+    /*
+        counts the number of distinct words that start with the specified prefix; the count is stored in every node, so this costs no more than finding the prefix
+        @param prefix, the prefix to search for
+        @return an integer representing the number of words that begin with the prefix
+    */
+    int getPrefixCount(const std::string &prefix) const;
+
+    /*
+        returns the number of occurrences of the specified word
+        @param word, word to find the occurrence count of
+        @return an integer representing the occurrence count of the word
+    */
+    int getOccurrenceCount(const std::string &word) const;
+
+    /*
+        checks to see if the trie is empty
+        @return true if the trie is empty, and false if not empty
+    */
+    bool isEmpty() const;
+
+    /*
+        returns the number of nodes, including the root
+        @return an integer representing the number of nodes
+    */
+    size_t nodeCount() const;
+
+    /*
+        returns the memory used by the arrays
+        @return the size of the arrays in bytes
+    */
+    size_t sizeInBytes() const;
+
+    /*
+        displays all the words in the trie
+    */
+    void display() const;
+private:
+    static const int ALPHABET_SIZE_ = 26; //letters a-z; they are given the codes 1 to 26
+    static const int32_t FREE_ = -1; //'check_' of a unit that is not a node
+
+    /*
+        a node of the trie; 'base_' places its children and 'check_' names its parent
+    */
+    struct Unit
+    {
+        int32_t base_; //the child for the letter with code 'c' is at index 'base_ + c'
+        int32_t check_; //index of the parent node, or 'FREE_'
+    };
+
+    std::vector<Unit> units_; //the double array; index 0 is the root
+    std::vector<uint32_t> occurrence_counts_; //number of occurrences of the word that ends at each node; 0 if no word ends there
+    std::vector<uint32_t> word_counts_; //number of distinct words that end at or below each node; read only once the walk to a node is done, so it is kept apart from 'units_'
+    size_t first_free_; //lowest index that might not be a node; where the search for the next base starts
+    size_t node_count_; //number of nodes, including the root
+
+    /*
+        returns the code of a letter
+        @param c, the letter
+        @return 1 to 26 for the letters a-z, or -1 for any other character
+    */
+    static int letterCode(char c);
+
+    /*
+        follows the path of a word or prefix from the root
+        @param word, the word or prefix to follow
+        @return index of the node at the end of the path, or -1 if the path does not exist
+    */
+    int32_t findNode(const std::string &word) const;
+
+    /*
+        finds a base at which every child of a node lands on a unit that is not a node, and claims those units for the node
+        @param parent, index of the node
+        @param codes, codes of the node's children in increasing order; not empty
+        @return the base for the node
+    */
+    int32_t placeChildren(int32_t parent, const std::vector<int> &codes);
+
+    /*
+        grows the arrays to hold at least the specified number of units
+        @param size, the number of units needed
+    */
+    void ensureSize(size_t size);
+
+    /*
+        copies a trie node's children, and the subtrees below them, into the arrays
+        @param node, the trie node
+        @param index, index of the unit that 'node' was copied to
+        @return the number of distinct words that end at or below the node
+    */
+    uint32_t buildFromNode(Node *node, int32_t index);
+
+    /*
+        copies the words of a sorted range that share their first 'depth' letters into the arrays
+        @param words, the sorted list of words
+        @param first, index of the first word of the range
+        @param last, index one past the last word of the range
+        @param depth, number of letters that every word of the range shares; the range's node is at this depth
+        @param index, index of the range's node
+        @return the number of distinct words in the range
+    */
+    uint32_t buildFromRange(const std::vector<std::string> &words, size_t first, size_t last, size_t depth, int32_t index);
+
+    /*
+        shrinks the arrays to the last node, once the build is done
+    */
+    void finishBuild();
+
+    /*
+        displays all the words at or below a node
+        @param index, index of the current node
+        @param word, the letters on the path to the node
+    */
+    void displayHelper(int32_t index, std::string &word) const;
+};
+
+#include "DoubleArrayTrie.cpp"
+#endif
@@ -5,9 +5,9 @@ Description: Trie node class implementation.
 Date Created: 7/4/2021
 */
 
-Node::Node():character_('\0'), end_of_word_(false), occurence_count_(0) { }
+Node::Node():children_(), character_('\0'), end_of_word_(false), occurence_count_(0) { }
 
-Node::Node(char c):character_(c), end_of_word_(false), occurence_count_(0) { }
+Node::Node(char c):children_(), character_(c), end_of_word_(false), occurence_count_(0) { }
 
 void Node::setChar(char c)
 {
@@ -73,6 +73,8 @@ public:
     */
     void display() const;
 private:
+    friend class DoubleArrayTrie; //reads the nodes directly to build its compact copy
+
     Node *root_ptr_; //pointer to the root node of the trie
 
     /*
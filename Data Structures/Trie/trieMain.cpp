@@ -6,8 +6,11 @@ Date Created: 7/4/2021
 */
 
 #include <iostream>
+#include <string>
+#include <vector>
 #include "Node.hpp"
 #include "Trie.hpp"
+#include "DoubleArrayTrie.hpp"
 
 using namespace std;
 
@@ -47,6 +50,27 @@ int main()
     cout << "Display: " << endl << endl;
     myTrie.display();
 
+    /*
+        double-array trie test; a compact copy of the trie, and one built straight from a sorted word list
+    */
+    DoubleArrayTrie myCompactTrie(myTrie);
+
+    cout << endl << "Word Count (Double-Array): " << myCompactTrie.getWordCount() << endl;
+    cout << "Prefix Count (Double-Array): " << myCompactTrie.getPrefixCount("ap") << endl;
+    cout << "Occurrence Count (Double-Array): " << myCompactTrie.getOccurrenceCount("dinosaur") << endl;
+    cout << "Search (Double-Array): " << myCompactTrie.search("there") << endl;
+    cout << "Search Prefix (Double-Array): " << myCompactTrie.search("theo") << endl;
+    cout << "Nodes (Double-Array): " << myCompactTrie.nodeCount() << endl;
+    cout << "Bytes (Double-Array): " << myCompactTrie.sizeInBytes() << " (vs " << myCompactTrie.nodeCount() * sizeof(Node) << " for the trie's nodes)" << endl;
+
+    vector<string> myWords = {"bea", "brock", "bull", "colt", "colt", "crow", "crow", "crow", "penny", "poco", "shelly", "spike"};
+    DoubleArrayTrie myListTrie(myWords);
+
+    cout << "Prefix Count (Word List): " << myListTrie.getPrefixCount("c") << endl;
+    cout << "Occurrence Count (Word List): " << myListTrie.getOccurrenceCount("crow") << endl;
+    cout << "Display (Word List): " << endl << endl;
+    myListTrie.display();
+
     /*
         clear method test
     */
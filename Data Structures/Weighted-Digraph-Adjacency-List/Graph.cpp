@@ -10,6 +10,9 @@ Date Created: 7/24/2021
 #include <queue> //for BFS
 #include <stack> //for DFS
 #include <utility> //for pairs
+#include <cstdint>
+#include <climits>
+#include <stdexcept> //for std::invalid_argument
 
 template <typename ItemType>
 Graph<ItemType>::Graph() { }
@@ -236,6 +239,69 @@ void Graph<ItemType>::recursiveDFSHelper(ItemType curr_vertex, std::map<Vertex<I
     }
 }
 
+template <typename ItemType>
+void Graph<ItemType>::dijkstra(ItemType source) const
+{
+    std::map<Vertex<ItemType>, uint64_t> paths; //map of the shortest path to every visited vertex; key = vertex and value = path length
+    RadixHeap<uint64_t, ItemType> frontier; //vertices reached but not yet visited, keyed by the length of the path they were reached by; a vertex may be in it more than once
+
+    if(graph_.find(Vertex<ItemType>(source)) == graph_.end())
+    {
+        std::cout << "Source vertex not found!" << std::endl;
+        return;
+    }
+
+    frontier.push(0, source); //distance from the source to itself is '0'
+
+    while(!frontier.isEmpty())
+    {
+        uint64_t distance = frontier.topKey(); //length of the shortest path among the reached vertices
+        Vertex<ItemType> curr_vertex = Vertex<ItemType>(frontier.top());
+        frontier.pop();
+
+        if(paths.find(curr_vertex) != paths.end()) //already visited through a shorter path; this entry is stale
+        {
+            continue;
+        }
+
+        paths[curr_vertex] = distance; //the first time a vertex leaves the heap, its path is the shortest
+
+        typename std::map<Vertex<ItemType>, std::list<std::pair<Vertex<ItemType>, int>>>::const_iterator j = graph_.find(curr_vertex); //find the current vertex to get its list
+
+        for(auto adj_vertex : j->second) //relax every adjacent vertex that is not already visited
+        {
+            if(adj_vertex.second < 0)
+            {
+                throw(std::invalid_argument("Dijkstra's algorithm needs non-negative edge weights!"));
+            }
+
+            if(paths.find(adj_vertex.first) == paths.end())
+            {
+                frontier.push(distance + adj_vertex.second, adj_vertex.first.getItem()); //never smaller than 'distance', which is the front of the heap
+            }
+        }
+    }
+
+    //print every vertex and its shortest path; unreachable vertices print 'INT_MAX', as in the adjacency matrix version
+    typename std::map<Vertex<ItemType>, std::list<std::pair<Vertex<ItemType>, int>>>::const_iterator i;
+
+    for(i = graph_.begin(); i != graph_.end(); i++)
+    {
+        typename std::map<Vertex<ItemType>, uint64_t>::const_iterator j = paths.find(i->first);
+
+        std::cout << i->first.getItem() << " --> ";
+
+        if(j != paths.end())
+        {
+            std::cout << j->second << std::endl;
+        }
+        else
+        {
+            std::cout << INT_MAX << std::endl;
+        }
+    }
+}
+
 template <typename ItemType>
 void Graph<ItemType>::display() const
 {
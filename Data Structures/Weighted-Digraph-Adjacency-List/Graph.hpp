@@ -85,6 +85,12 @@ public:
     */
     void recursiveDFS(ItemType start) const;
 
+    /*
+        performs Dijkstra's shortest path algorithm using the specified source vertex; the path lengths only ever grow, so the vertices to visit are kept in a radix heap instead of a comparison-based heap
+        @param source, the vertex to start the algorithm from; every edge weight must be non-negative
+    */
+    void dijkstra(ItemType source) const;
+
     /*
         prints out every adjacency list that makes up the graph
     */
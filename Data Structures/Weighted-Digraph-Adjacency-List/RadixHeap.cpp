@@ -0,0 +1,172 @@
+/*
+Title: Radix Heap
+Author: Edwin Khew
+Description: Radix heap class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <stdexcept> //for std::out_of_range
+#include <utility> //for std::move
+
+template<typename KeyType, typename ItemType>
+RadixHeap<KeyType, ItemType>::RadixHeap():last_(0), item_count_(0) { }
+
+template<typename KeyType, typename ItemType>
+void RadixHeap<KeyType, ItemType>::push(KeyType key, const ItemType &new_item)
+{
+    if(key < last_)
+    {
+        throw(std::out_of_range("Key is smaller than the front of the heap!"));
+    }
+
+    buckets_[bucketIndex(key)].push_back(std::make_pair(key, new_item));
+    item_count_++;
+}
+
+template<typename KeyType, typename ItemType>
+bool RadixHeap<KeyType, ItemType>::pop()
+{
+    if(isEmpty())
+    {
+        return false;
+    }
+
+    refill();
+
+    buckets_[0].pop_back();
+    item_count_--;
+
+    return true;
+}
+
+template<typename KeyType, typename ItemType>
+const ItemType &RadixHeap<KeyType, ItemType>::top() const
+{
+    if(isEmpty())
+    {
+        throw(std::out_of_range("Heap is empty!"));
+    }
+
+    refill();
+
+    return buckets_[0].back().second;
+}
+
+template<typename KeyType, typename ItemType>
+KeyType RadixHeap<KeyType, ItemType>::topKey() const
+{
+    if(isEmpty())
+    {
+        throw(std::out_of_range("Heap is empty!"));
+    }
+
+    refill();
+
+    return last_;
+}
+
+template<typename KeyType, typename ItemType>
+void RadixHeap<KeyType, ItemType>::clear()
+{
+    for(int i = 0; i < BUCKET_COUNT_; i++)
+    {
+        buckets_[i].clear(); //keeps the memory of every bucket for reuse
+    }
+
+    last_ = 0;
+    item_count_ = 0;
+}
+
+template<typename KeyType, typename ItemType>
+size_t RadixHeap<KeyType, ItemType>::size() const
+{
+    return item_count_;
+}
+
+template<typename KeyType, typename ItemType>
+bool RadixHeap<KeyType, ItemType>::isEmpty() const
+{
+    return item_count_ == 0;
+}
+
+template<typename KeyType, typename ItemType>
+void RadixHeap<KeyType, ItemType>::peek() const
+{
+    if(!isEmpty())
+    {
+        std::cout << top();
+    }
+    else
+    {
+        std::cout << "Heap is empty!";
+    }
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+template<typename KeyType, typename ItemType>
+int RadixHeap<KeyType, ItemType>::bucketIndex(KeyType key) const
+{
+    if(key == last_)
+    {
+        return 0;
+    }
+
+    return highestBit(static_cast<uint64_t>(key ^ last_)) + 1;
+}
+
+template<typename KeyType, typename ItemType>
+void RadixHeap<KeyType, ItemType>::refill() const
+{
+    if(!buckets_[0].empty())
+    {
+        return;
+    }
+
+    int i = 1;
+
+    while(buckets_[i].empty()) //find the lowest non-empty bucket
+    {
+        i++;
+    }
+
+    KeyType min_key = buckets_[i][0].first;
+
+    for(size_t j = 1; j < buckets_[i].size(); j++)
+    {
+        if(buckets_[i][j].first < min_key)
+        {
+            min_key = buckets_[i][j].first;
+        }
+    }
+
+    last_ = min_key; //every key of the bucket now differs from 'last_' at a lower bit than before, so each item moves to a lower bucket
+
+    for(size_t j = 0; j < buckets_[i].size(); j++)
+    {
+        buckets_[bucketIndex(buckets_[i][j].first)].push_back(std::move(buckets_[i][j]));
+    }
+
+    buckets_[i].clear();
+}
+
+template<typename KeyType, typename ItemType>
+int RadixHeap<KeyType, ItemType>::highestBit(uint64_t value)
+{
+#if defined(__GNUC__)
+    return 63 - __builtin_clzll(value);
+#else
+    int position = 0;
+
+    while(value > 1)
+    {
+        value >>= 1;
+        position++;
+    }
+
+    return position;
+#endif
+}
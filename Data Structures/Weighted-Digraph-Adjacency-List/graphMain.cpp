@@ -7,6 +7,7 @@ Date Created: 7/24/2021
 
 #include <iostream>
 #include "Vertex.hpp"
+#include "RadixHeap.hpp"
 #include "Graph.hpp"
 
 using namespace std;
@@ -52,4 +53,7 @@ int main()
     cout << endl << "Display: " << endl << endl;
 
     myGraph.display();
+
+    cout << endl << "Dijkstra's Algorithm: " << endl;
+    myGraph.dijkstra("Aa");
 }
@@ -277,29 +277,33 @@ template <typename ItemType>
 void Graph<ItemType>::dijkstra(ItemType source) const
 {
     int paths[vertex_count_]; //array to store the shortest paths
-    bool visited[vertex_count_]; //array used to keep track of visited vertices
+    IndexedPriorityQueue<int>::Handle handles[vertex_count_]; //handle of each vertex in the queue; a vertex is visited once it has left the queue
+    IndexedPriorityQueue<int> unvisited; //queue of unvisited vertex indices, ordered by their current smallest path
+
+    typename std::map<Vertex<ItemType>, int>::const_iterator v = vertex_map_.find(Vertex<ItemType>(source)); //find the source vertex in the map to get its index
+
+    //initialize every shortest path to 'INT_MAX', except the distance from the source to itself, which is '0'; every vertex starts out unvisited
+    unvisited.reserve(vertex_count_);
 
-    //initialize every shortest path to 'INT_MAX', and every vertex to 'false' to mark as unvisited
     for(int i = 0; i < vertex_count_; i++)
     {
-        paths[i] = INT_MAX;
-        visited[i] = false;
+        paths[i] = i == v->second ? 0 : INT_MAX;
+        handles[i] = unvisited.push(i, paths[i]);
     }
 
-    typename std::map<Vertex<ItemType>, int>::const_iterator v = vertex_map_.find(Vertex<ItemType>(source)); //find the source vertex in the map to get its index
-    paths[v->second] = 0; //distance from the source to itself is '0'
-
-    for(int i = 0; i < vertex_count_ - 1; i++)
+    //the queue hands out the unvisited vertex with the current smallest path in O(log V), instead of scanning every vertex for it
+    while(!unvisited.isEmpty() && unvisited.topPriority() != INT_MAX) //stop once only unreachable vertices remain
     {
-        int min = minDistance(paths, visited); //index of the unvisited vertex with the current smallest path
-        visited[min] = true; //mark the vertex as visited
+        int min = unvisited.top(); //index of the unvisited vertex with the current smallest path
+        unvisited.pop(); //mark the vertex as visited
 
         for(int j = 0; j < vertex_count_; j++) //relax every adjacent vertex, if possible
         {
             //if the adjacent vertex is not already visited, an edge exists, and a new smaller path is found, set the new smallest path
-            if (!visited[j] && matrix_[min][j] != NULL_EDGE_ && paths[min] + matrix_[min][j] < paths[j])
+            if(unvisited.contains(handles[j]) && matrix_[min][j] != NULL_EDGE_ && paths[min] + matrix_[min][j] < paths[j])
             {
                 paths[j] = paths[min] + matrix_[min][j];
+                unvisited.decreaseKey(handles[j], paths[j]); //move the vertex up the queue
             }
         }
     }
@@ -307,24 +311,6 @@ void Graph<ItemType>::dijkstra(ItemType source) const
     dijkstraDisplay(paths);
 }
 
-template <typename ItemType>
-int Graph<ItemType>::minDistance(int paths[], bool visited[]) const
-{
-    int min = INT_MAX; //current minimum path
-    int min_index; //index of the current minimum path
-
-    for(int i = 0; i < vertex_count_; i++)
-    {
-        if(visited[i] == false && paths[i] <= min)
-        {
-            min = paths[i];
-            min_index = i;
-        }
-    }
-
-    return min_index;
-}
-
 template <typename ItemType>
 void Graph<ItemType>::dijkstraDisplay(int paths[]) const
 {
@@ -0,0 +1,256 @@
+/*
+Title: Indexed Priority Queue (addressable binary heap)
+Author: Edwin Khew
+Description: Indexed priority queue class implementation.
+Date Created: 10/17/2026
+*/
+
+#include <iostream>
+#include <stdexcept> //for std::out_of_range and std::invalid_argument
+#include <utility> //for std::move
+
+template<typename ItemType, typename PriorityType>
+IndexedPriorityQueue<ItemType, PriorityType>::IndexedPriorityQueue() { }
+
+template<typename ItemType, typename PriorityType>
+typename IndexedPriorityQueue<ItemType, PriorityType>::Handle IndexedPriorityQueue<ItemType, PriorityType>::push(const ItemType &new_item, PriorityType priority)
+{
+    Handle handle;
+
+    if(!free_handles_.empty()) //reuse the handle of a removed item, so that 'position_' stays as small as the largest the queue has been
+    {
+        handle = free_handles_.back();
+        free_handles_.pop_back();
+    }
+    else
+    {
+        handle = position_.size();
+        position_.resize(handle + 1); //the new slot is set below
+    }
+
+    heap_.push_back(Entry{priority, handle, new_item}); //insert the new entry to the end of the array
+    position_[handle] = heap_.size() - 1;
+
+    siftUp(heap_.size() - 1); //heapify the array
+
+    return handle;
+}
+
+template<typename ItemType, typename PriorityType>
+bool IndexedPriorityQueue<ItemType, PriorityType>::pop()
+{
+    if(isEmpty())
+    {
+        return false;
+    }
+
+    removeAt(0);
+
+    return true;
+}
+
+template<typename ItemType, typename PriorityType>
+void IndexedPriorityQueue<ItemType, PriorityType>::decreaseKey(Handle handle, PriorityType new_priority)
+{
+    checkHandle(handle);
+
+    size_t item_index = position_[handle];
+
+    if(heap_[item_index].priority_ < new_priority)
+    {
+        throw(std::invalid_argument("New priority is greater than the current priority!"));
+    }
+
+    heap_[item_index].priority_ = new_priority;
+
+    siftUp(item_index); //a lower priority can only move the entry towards the root
+}
+
+template<typename ItemType, typename PriorityType>
+void IndexedPriorityQueue<ItemType, PriorityType>::erase(Handle handle)
+{
+    checkHandle(handle);
+
+    removeAt(position_[handle]);
+}
+
+template<typename ItemType, typename PriorityType>
+bool IndexedPriorityQueue<ItemType, PriorityType>::contains(Handle handle) const
+{
+    return handle < position_.size() && position_[handle] != NOT_QUEUED_;
+}
+
+template<typename ItemType, typename PriorityType>
+const ItemType &IndexedPriorityQueue<ItemType, PriorityType>::top() const
+{
+    if(isEmpty())
+    {
+        throw(std::out_of_range("Queue is empty!"));
+    }
+
+    return heap_[0].item_;
+}
+
+template<typename ItemType, typename PriorityType>
+PriorityType IndexedPriorityQueue<ItemType, PriorityType>::topPriority() const
+{
+    if(isEmpty())
+    {
+        throw(std::out_of_range("Queue is empty!"));
+    }
+
+    return heap_[0].priority_;
+}
+
+template<typename ItemType, typename PriorityType>
+typename IndexedPriorityQueue<ItemType, PriorityType>::Handle IndexedPriorityQueue<ItemType, PriorityType>::topHandle() const
+{
+    if(isEmpty())
+    {
+        throw(std::out_of_range("Queue is empty!"));
+    }
+
+    return heap_[0].handle_;
+}
+
+template<typename ItemType, typename PriorityType>
+PriorityType IndexedPriorityQueue<ItemType, PriorityType>::getPriority(Handle handle) const
+{
+    checkHandle(handle);
+
+    return heap_[position_[handle]].priority_;
+}
+
+template<typename ItemType, typename PriorityType>
+void IndexedPriorityQueue<ItemType, PriorityType>::clear()
+{
+    heap_.clear();
+    position_.clear();
+    free_handles_.clear();
+}
+
+template<typename ItemType, typename PriorityType>
+void IndexedPriorityQueue<ItemType, PriorityType>::reserve(size_t count)
+{
+    heap_.reserve(count);
+    position_.reserve(count);
+}
+
+template<typename ItemType, typename PriorityType>
+size_t IndexedPriorityQueue<ItemType, PriorityType>::size() const
+{
+    return heap_.size();
+}
+
+template<typename ItemType, typename PriorityType>
+bool IndexedPriorityQueue<ItemType, PriorityType>::isEmpty() const
+{
+    return heap_.empty();
+}
+
+template<typename ItemType, typename PriorityType>
+void IndexedPriorityQueue<ItemType, PriorityType>::peek() const
+{
+    if(isEmpty())
+    {
+        std::cout << "List is empty!";
+    }
+    else
+    {
+        std::cout << heap_[0].item_;
+    }
+}
+
+/**************************************************************************************************
+                                    Helper functions below.
+**************************************************************************************************/
+
+template<typename ItemType, typename PriorityType>
+void IndexedPriorityQueue<ItemType, PriorityType>::siftUp(size_t item_index)
+{
+    Entry entry = std::move(heap_[item_index]); //the entry is held aside and moved into place once; each parent it passes moves down into the hole
+
+    while(item_index > 0)
+    {
+        size_t parent_index = (item_index - 1) / 2;
+
+        if(!(entry.priority_ < heap_[parent_index].priority_))
+        {
+            break;
+        }
+
+        heap_[item_index] = std::move(heap_[parent_index]);
+        position_[heap_[item_index].handle_] = item_index;
+        item_index = parent_index;
+    }
+
+    heap_[item_index] = std::move(entry);
+    position_[heap_[item_index].handle_] = item_index;
+}
+
+template<typename ItemType, typename PriorityType>
+void IndexedPriorityQueue<ItemType, PriorityType>::siftDown(size_t item_index)
+{
+    size_t count = heap_.size();
+    Entry entry = std::move(heap_[item_index]);
+
+    while(2 * item_index + 1 < count)
+    {
+        size_t child_index = 2 * item_index + 1; //left child
+
+        if(child_index + 1 < count && heap_[child_index + 1].priority_ < heap_[child_index].priority_) //pick the child with the lower priority
+        {
+            child_index++;
+        }
+
+        if(!(heap_[child_index].priority_ < entry.priority_))
+        {
+            break;
+        }
+
+        heap_[item_index] = std::move(heap_[child_index]);
+        position_[heap_[item_index].handle_] = item_index;
+        item_index = child_index;
+    }
+
+    heap_[item_index] = std::move(entry);
+    position_[heap_[item_index].handle_] = item_index;
+}
+
+template<typename ItemType, typename PriorityType>
+void IndexedPriorityQueue<ItemType, PriorityType>::removeAt(size_t item_index)
+{
+    Handle handle = heap_[item_index].handle_;
+    size_t last_index = heap_.size() - 1;
+
+    if(item_index != last_index)
+    {
+        heap_[item_index] = std::move(heap_[last_index]); //fill the hole with the last entry
+        position_[heap_[item_index].handle_] = item_index;
+    }
+
+    heap_.pop_back();
+    position_[handle] = NOT_QUEUED_;
+    free_handles_.push_back(handle);
+
+    if(item_index < heap_.size()) //the moved entry may belong either above or below the hole
+    {
+        if(item_index > 0 && heap_[item_index].priority_ < heap_[(item_index - 1) / 2].priority_)
+        {
+            siftUp(item_index);
+        }
+        else
+        {
+            siftDown(item_index);
+        }
+    }
+}
+
+template<typename ItemType, typename PriorityType>
+void IndexedPriorityQueue<ItemType, PriorityType>::checkHandle(Handle handle) const
+{
+    if(!contains(handle))
+    {
+        throw(std::out_of_range("Handle is not in the queue!"));
+    }
+}
@@ -0,0 +1,159 @@
+/*
+Title: Indexed Priority Queue (addressable binary heap)
+Author: Edwin Khew
+Description: Indexed priority queue class declaration.
+Date Created: 10/17/2026
+*/
+
+#ifndef INDEXED_PRIORITY_QUEUE_H_
+#define INDEXED_PRIORITY_QUEUE_H_
+
+#include <cstddef>
+#include <vector>
+
+/*
+    a binary min-heap that hands out a handle for every item it holds; the handle can later be used to lower the item's priority or to remove it, which is what Dijkstra's and Prim's algorithms (and rescheduling a pending event) need
+    handles are small integers; a table maps each handle to the item's current position in the heap, and is updated every time the item moves
+*/
+template <class ItemType, class PriorityType = int>
+class IndexedPriorityQueue
+{
+public:
+    typedef size_t Handle; //identifies an item of the queue until it is removed
+
+    /*
+        default constructor
+    */
+    IndexedPriorityQueue();
+
+    /*
+        inserts a new item into the queue, based on its priority; items with lower priority values leave the queue first
+        @param new_item, item to be inserted
+        @param priority, priority of the item
+        @return the handle of the new item; valid until the item leaves the queue, after which it may be given to another item
+    */
+    Handle push(const ItemType &new_item, PriorityType priority);
+
+    /*
+        removes the item at the front of the queue
+        @return true if the item was successfully removed, and false otherwise
+    */
+    bool pop();
+
+    /*
+        lowers the priority of an item, moving it towards the front of the queue
+        @param handle, handle of the item
+        @param new_priority, the new priority; must not be greater than the current one
+    */
+    void decreaseKey(Handle handle, PriorityType new_priority);
+
+    /*
+        removes an item from anywhere in the queue
+        @param handle, handle of the item to remove
+    */
+    void erase(Handle handle);
+
+    /*
+        checks if a handle belongs to an item that is still in the queue
+        @param handle, handle to check
+        @return true if the item is in the queue, and false otherwise
+    */
+    bool contains(Handle handle) const;
+
+    /*
+        returns the item at the front of the queue
+        @return a reference to the item with the lowest priority value; valid until the queue is next modified
+    */
+    const ItemType &top() const;
+
+    /*
+        returns the priority of the item at the front of the queue
+        @return the lowest priority value in the queue
+    */
+    PriorityType topPriority() const;
+
+    /*
+        returns the handle of the item at the front of the queue
+        @return the handle of the item with the lowest priority value
+    */
+    Handle topHandle() const;
+
+    /*
+        returns the current priority of an item
+        @param handle, handle of the item
+        @return the item's priority
+    */
+    PriorityType getPriority(Handle handle) const;
+
+    /*
+        clears the queue; every handle becomes invalid
+        @post queue is now empty
+    */
+    void clear();
+
+    /*
+        makes room for the specified number of items, so that pushing them does not reallocate
+        @param count, number of items the queue should be able to hold
+    */
+    void reserve(size_t count);
+
+    /*
+        returns the current number of items in the queue
+        @return the number of items in the queue
+    */
+    size_t size() const;
+
+    /*
+        checks if the queue is empty
+        @return true if the queue is empty, and false otherwise
+    */
+    bool isEmpty() const;
+
+    /*
+        prints a copy of the item at the front of the queue
+    */
+    void peek() const;
+private:
+    static const size_t NOT_QUEUED_ = static_cast<size_t>(-1); //position of a handle whose item is not in the queue
+
+    /*
+        an item of the queue; the priority is kept next to the handle so that sifting compares without leaving the heap array
+    */
+    struct Entry
+    {
+        PriorityType priority_; //priority of the item
+        Handle handle_; //handle of the item; the index of its slot in 'position_'
+        ItemType item_; //the item itself
+    };
+
+    std::vector<Entry> heap_; //binary heap of the entries; the entry with the lowest priority is at index 0
+    std::vector<size_t> position_; //maps each handle to the index of its entry in 'heap_', or 'NOT_QUEUED_'
+    std::vector<Handle> free_handles_; //handles of removed items, given out again before new ones are created
+
+    /*
+        moves an entry up from the specified index until its parent does not have a greater priority
+        @param item_index, index of the entry to move up
+    */
+    void siftUp(size_t item_index);
+
+    /*
+        moves an entry down from the specified index until neither of its children has a lower priority
+        @param item_index, index of the entry to move down
+    */
+    void siftDown(size_t item_index);
+
+    /*
+        removes the entry at the specified index, filling its place with the last entry
+        @param item_index, index of the entry to remove
+    */
+    void removeAt(size_t item_index);
+
+    /*
+        throws if a handle does not belong to an item in the queue
+        @param handle, handle to check
+    */
+    void checkHandle(Handle handle) const;
+};
+
+#include "IndexedPriorityQueue.cpp"
+#endif
@@ -7,6 +7,7 @@ Date Created: 7/20/2021
 
 #include <iostream>
 #include "Vertex.hpp"
+#include "IndexedPriorityQueue.hpp"
 #include "Graph.hpp"
 
 using namespace std;